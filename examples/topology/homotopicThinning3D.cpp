@@ -29,13 +29,13 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
-#include <queue>
 #include "DGtal/base/Common.h"
 #include "DGtal/io/viewers/Viewer3D.h"
 #include "DGtal/io/DrawWithDisplay3DModifier.h"
 #include "DGtal/io/Color.h"
 #include "DGtal/shapes/Shapes.h"
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/HomotopicThinning.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -76,43 +76,9 @@ int main( int argc, char** argv )
   
   trace.beginBlock ( "Thinning" );
   Object18_6 shape( dt18_6,  shape_set );
-  int nb_simple=0; 
-  DigitalSet::Iterator it, itE;
-  do 
-    {
-      DigitalSet & S = shape.pointSet();
-      std::queue<DigitalSet::Iterator> Q;
-      it = S.begin(); 
-      itE = S.end();
-#ifdef WITH_OPENMP
-      std::vector<DigitalSet::Iterator> v( S.size() );
-      std::vector<uint8_t> b( v.size() );
-      for ( size_t i = 0; it != itE; ++it, ++i )
-	v[ i ] = it;
-#pragma omp parallel for schedule(dynamic)
-      for ( size_t i = 0; i < v.size(); ++i )
-	b[ i ] = shape.isSimple( *(v[ i ]) );
-
-      for ( size_t i = 0; i < v.size(); ++i )
-	if ( b[ i ] ) Q.push( v[ i ] ); 
-#else
-      for ( ; it != itE; ++it )
-	if ( shape.isSimple( *it ) )
-	  Q.push( it );
-#endif
-      nb_simple = 0;
-      while ( ! Q.empty() )
-	{
-	  DigitalSet::Iterator itt = Q.front();
-	  Q.pop();
-	  if ( shape.isSimple( *itt ) )
-	    {
-	      S.erase( *itt );
-	      ++nb_simple;
-	    }
-	}
-    }
-  while ( nb_simple != 0 );
+  HomotopicThinning<Object18_6> thinning( shape );
+  // Simple points of a same subfield are removed in parallel.
+  thinning.thinBySubfields();
   DigitalSet & S = shape.pointSet();
   trace.endBlock();
 
@@ -0,0 +1,290 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SortedVectorSet.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module SortedVectorSet.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SortedVectorSet_RECURSES)
+#error Recursive header files inclusion detected in SortedVectorSet.h
+#else // defined(SortedVectorSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SortedVectorSet_RECURSES
+
+#if !defined SortedVectorSet_h
+/** Prevents repeated inclusion of headers. */
+#define SortedVectorSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <functional>
+#include <utility>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SortedVectorSet
+  /**
+     Description of template class 'SortedVectorSet' <p> \brief
+     Aim: A set of values stored in a sorted std::vector, with the
+     interface of std::set for insertion, search and iteration.
+
+     The values are stored contiguously, without any per-element
+     overhead, and searched by dichotomy. Single insertions and
+     removals are linear in the size of the set, so the set should be
+     filled by batches: from a range at construction, or with
+     insert( first, last ), which appends the range, sorts it and
+     merges it with the current values. It is the compact choice for
+     big sets built once and then queried, e.g. the surfels of a
+     boundary.
+
+     @tparam TValue the type of values, which must be copyable.
+     @tparam TCompare a strict weak order on values (default std::less).
+
+     @see KhalimskyCellKey
+  */
+  template <typename TValue, typename TCompare = std::less<TValue> >
+  class SortedVectorSet
+  {
+  public:
+    typedef TValue Value;
+    typedef TCompare Compare;
+    typedef std::vector<Value> Container;
+    typedef typename Container::size_type Size;
+
+    // std::set-like types
+    typedef Value key_type;
+    typedef Value value_type;
+    typedef Size size_type;
+    typedef Compare key_compare;
+    typedef Compare value_compare;
+    typedef const Value & reference;
+    typedef const Value & const_reference;
+    typedef typename Container::const_iterator const_iterator;
+    typedef const_iterator iterator;
+    typedef typename Container::const_reverse_iterator const_reverse_iterator;
+    typedef const_reverse_iterator reverse_iterator;
+    typedef const_iterator ConstIterator;
+    typedef const_iterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The set is empty.
+     * @param aCompare the order on values.
+     */
+    SortedVectorSet( const Compare & aCompare = Compare() );
+
+    /**
+     * Batch constructor. O(n log n).
+     * @tparam InputIterator any input iterator on values.
+     * @param first the first value.
+     * @param last after the last value.
+     * @param aCompare the order on values.
+     */
+    template <typename InputIterator>
+    SortedVectorSet( InputIterator first, InputIterator last,
+                     const Compare & aCompare = Compare() );
+
+    // ----------------------- Set services ------------------------------
+  public:
+
+    /// @return the number of values.
+    Size size() const;
+
+    /// @return 'true' iff the set is empty.
+    bool empty() const;
+
+    /// Removes all the values.
+    void clear();
+
+    /**
+     * Requests that the capacity of the underlying vector be at least n.
+     * @param n the number of values.
+     */
+    void reserve( Size n );
+
+    /**
+     * Inserts a value. Linear in the size of the set.
+     * @param v any value.
+     * @return the iterator to v and 'true' if v has been inserted.
+     */
+    std::pair<iterator,bool> insert( const Value & v );
+
+    /**
+     * Inserts a value, as std::set. Linear in the size of the set.
+     * @param hint ignored.
+     * @param v any value.
+     * @return the iterator to v.
+     */
+    iterator insert( const_iterator hint, const Value & v );
+
+    /**
+     * Inserts a range of values at once. O(m log m + n) for m new
+     * values and n values in the set.
+     * @tparam InputIterator any input iterator on values.
+     * @param first the first value.
+     * @param last after the last value.
+     */
+    template <typename InputIterator>
+    void insert( InputIterator first, InputIterator last );
+
+    /**
+     * Removes a value. Linear in the size of the set.
+     * @param v any value.
+     * @return the number of removed values (0 or 1).
+     */
+    Size erase( const Value & v );
+
+    /**
+     * Removes a value. Linear in the size of the set.
+     * @param it a valid iterator in the set.
+     */
+    void erase( const_iterator it );
+
+    /**
+     * Removes the values of the range [first,last). Linear in the
+     * size of the set.
+     * @param first the first value to remove.
+     * @param last after the last value to remove.
+     */
+    void erase( const_iterator first, const_iterator last );
+
+    /**
+     * @param v any value.
+     * @return an iterator to v, or end() if v is not in the set. O(log n).
+     */
+    const_iterator find( const Value & v ) const;
+
+    /**
+     * @param v any value.
+     * @return the number of occurences of v (0 or 1). O(log n).
+     */
+    Size count( const Value & v ) const;
+
+    /**
+     * @param v any value.
+     * @return the first value not smaller than v.
+     */
+    const_iterator lower_bound( const Value & v ) const;
+
+    /**
+     * @param v any value.
+     * @return the first value greater than v.
+     */
+    const_iterator upper_bound( const Value & v ) const;
+
+    /// @return the begin iterator (values are sorted).
+    const_iterator begin() const;
+
+    /// @return the end iterator.
+    const_iterator end() const;
+
+    /// @return the reverse begin iterator.
+    const_reverse_iterator rbegin() const;
+
+    /// @return the reverse end iterator.
+    const_reverse_iterator rend() const;
+
+    /**
+     * Swaps the values with another set.
+     * @param other any other set.
+     */
+    void swap( SortedVectorSet & other );
+
+    /// @return the underlying sorted vector.
+    const Container & container() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the values are sorted without duplicates.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The sorted values.
+    Container myValues;
+    /// The order on values.
+    Compare myCompare;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Sorts the values from index \a n and merges them with the n first ones.
+    void mergeFrom( Size n );
+
+    /// Equivalence of values w.r.t. the order.
+    struct Equivalent {
+      Equivalent( const Compare & aCompare ) : myCompare( aCompare ) {}
+      bool operator()( const Value & v1, const Value & v2 ) const
+      { return ! myCompare( v1, v2 ) && ! myCompare( v2, v1 ); }
+      Compare myCompare;
+    };
+
+  }; // end of class SortedVectorSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SortedVectorSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SortedVectorSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TValue, typename TCompare>
+  std::ostream&
+  operator<< ( std::ostream & out, const SortedVectorSet<TValue,TCompare> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/SortedVectorSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SortedVectorSet_h
+
+#undef SortedVectorSet_RECURSES
+#endif // else defined(SortedVectorSet_RECURSES)
@@ -95,6 +95,8 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
+        Matrix eigenVectors;
+        RealVector eigenValues;
         EigenDecomposition<Space::dimension, Component, Matrix>
           ::getEigenDecomposition( arg, eigenVectors, eigenValues );
 
@@ -115,11 +117,6 @@ namespace DGtal {
       */
       void init( Component /* h */, Component /* r */ ) {}
 
-    private: 
-      /// A data member only used for temporary calculations.
-      mutable Matrix eigenVectors;
-      /// A data member only used for temporary calculations.
-      mutable RealVector eigenValues;
     }; // end of class IINormalDirectionFunctor
 
 
@@ -170,6 +167,8 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
+        Matrix eigenVectors;
+        RealVector eigenValues;
         EigenDecomposition<Space::dimension, Component, Matrix>
           ::getEigenDecomposition( arg, eigenVectors, eigenValues );
 
@@ -184,11 +183,6 @@ namespace DGtal {
         return eigenVectors.column( 1 ); // tangent vector is associated to greatest eigenvalue.      
       }
 
-    private:
-      /// A data member only used for temporary calculations.
-      mutable Matrix eigenVectors;
-      /// A data member only used for temporary calculations.
-      mutable RealVector eigenValues;
     }; // end of class IITangentDirectionFunctor
 
 
@@ -243,6 +237,8 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
+        Matrix eigenVectors;
+        RealVector eigenValues;
         EigenDecomposition<Space::dimension, Component, Matrix>
           ::getEigenDecomposition( arg, eigenVectors, eigenValues );
 
@@ -263,11 +259,6 @@ namespace DGtal {
       */
       void init( Component /* h */, Component /* r */ ) {}
 
-    private:
-      /// A data member only used for temporary calculations.
-      mutable Matrix eigenVectors;
-      /// A data member only used for temporary calculations.
-      mutable RealVector eigenValues;
     }; // end of class IIFirstPrincipalDirectionFunctor
 
 
@@ -322,6 +313,8 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
+        Matrix eigenVectors;
+        RealVector eigenValues;
         EigenDecomposition<Space::dimension, Component, Matrix>
           ::getEigenDecomposition( arg, eigenVectors, eigenValues );
 
@@ -342,11 +335,6 @@ namespace DGtal {
       */
       void init( Component /* h */, Component /* r */ ) {}
 
-    private:
-      /// A data member only used for temporary calculations.
-      mutable Matrix eigenVectors;
-      /// A data member only used for temporary calculations.
-      mutable RealVector eigenValues;
     }; // end of class IISecondPrincipalDirectionFunctor
 
     /////////////////////////////////////////////////////////////////////////////
@@ -400,6 +388,8 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
+        Matrix eigenVectors;
+        RealVector eigenValues;
         EigenDecomposition<Space::dimension, Component, Matrix>
           ::getEigenDecomposition( arg, eigenVectors, eigenValues );
 
@@ -423,11 +413,6 @@ namespace DGtal {
       */
       void init( Component /* h */, Component /* r */ ) {}
 
-    private:
-      /// A data member only used for temporary calculations.
-      mutable Matrix eigenVectors;
-      /// A data member only used for temporary calculations.
-      mutable RealVector eigenValues;
     }; // end of class IIPrincipalDirectionsFunctor
 
     /////////////////////////////////////////////////////////////////////////////
@@ -598,6 +583,8 @@ namespace DGtal {
       {
         Argument cp_arg = arg;
         cp_arg *= dh5;
+        Matrix eigenVectors;
+        RealVector eigenValues;
         EigenDecomposition<Space::dimension, Component, Matrix>
           ::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
 
@@ -630,11 +617,6 @@ namespace DGtal {
       Quantity dh5;
       Quantity d6_PIr6;
       Quantity d8_5r;
-
-      /// A data member only used for temporary calculations.
-      mutable Matrix eigenVectors;
-      /// A data member only used for temporary calculations.
-      mutable RealVector eigenValues;
     }; // end of class IIGaussianCurvature3DFunctor
 
     /////////////////////////////////////////////////////////////////////////////
@@ -681,6 +663,8 @@ namespace DGtal {
       {
         Argument cp_arg = arg;
         cp_arg *= dh5;
+        Matrix eigenVectors;
+        RealVector eigenValues;
         EigenDecomposition<Space::dimension, Component, Matrix>
           ::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
 
@@ -712,11 +696,6 @@ namespace DGtal {
       Quantity dh5;
       Quantity d6_PIr6;
       Quantity d8_5r;
-
-      /// A data member only used for temporary calculations.
-      mutable Matrix eigenVectors;
-      /// A data member only used for temporary calculations.
-      mutable RealVector eigenValues;
     }; // end of class IIFirstPrincipalCurvature3DFunctor
 
     /////////////////////////////////////////////////////////////////////////////
@@ -763,6 +742,8 @@ namespace DGtal {
       {
         Argument cp_arg = arg;
         cp_arg *= dh5;
+        Matrix eigenVectors;
+        RealVector eigenValues;
         EigenDecomposition<Space::dimension, Component, Matrix>
           ::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
 
@@ -793,11 +774,6 @@ namespace DGtal {
       Quantity dh5;
       Quantity d6_PIr6;
       Quantity d8_5r;
-
-      /// A data member only used for temporary calculations.
-      mutable Matrix eigenVectors;
-      /// A data member only used for temporary calculations.
-      mutable RealVector eigenValues;
     }; // end of class IISecondPrincipalCurvature3DFunctor
 
 
@@ -845,6 +821,8 @@ namespace DGtal {
       {
         Argument cp_arg = arg;
         cp_arg *= dh5;
+        Matrix eigenVectors;
+        RealVector eigenValues;
         EigenDecomposition<Space::dimension, Component, Matrix>
           ::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
 
@@ -878,11 +856,6 @@ namespace DGtal {
       double dh5;
       double d6_PIr6;
       double d8_5r;
-
-      /// A data member only used for temporary calculations.
-      mutable Matrix eigenVectors;
-      /// A data member only used for temporary calculations.
-      mutable RealVector eigenValues;
     }; // end of class IIPrincipalCurvatures3DFunctor
 
 } // namespace functors
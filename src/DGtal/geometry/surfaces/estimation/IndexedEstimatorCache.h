@@ -0,0 +1,488 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IndexedEstimatorCache.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module IndexedEstimatorCache
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IndexedEstimatorCache_RECURSES)
+#error Recursive header files inclusion detected in IndexedEstimatorCache.h
+#else // defined(IndexedEstimatorCache_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IndexedEstimatorCache_RECURSES
+
+#if !defined IndexedEstimatorCache_h
+/** Prevents repeated inclusion of headers. */
+#define IndexedEstimatorCache_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/geometry/surfaces/estimation/CSurfelLocalEstimator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedEstimatorCache
+  /**
+   * Description of template class 'IndexedEstimatorCache' <p>
+   * \brief Aim: this class adapts any local surface estimator to cache the estimated
+   * values in an array indexed by the vertices of an indexed digital
+   * surface (see IndexedDigitalSurface).
+   *
+   * Contrary to EstimatorCache, which stores the values in an
+   * associative container, the values are stored in a vector whose
+   * size is the number of surfels. Evaluation at a vertex (see
+   * value()) is a single array access, and evaluation at a surfel
+   * costs one hash lookup (IndexedDigitalSurface::vertex).
+   *
+   * init() copies the range of surfels and evaluates the estimator by
+   * ranges of consecutive surfels, so that estimators with an
+   * optimized range evaluation (e.g. IntegralInvariantVolumeEstimator,
+   * IntegralInvariantCovarianceEstimator) can use it even when the
+   * given surfel iterators are single pass. initParallel() does the
+   * same, but evaluates the ranges in parallel when WITH_OPENMP is
+   * defined.
+   *
+   * The cached values may be written to a binary stream (see save())
+   * and read back later for the same indexed surface (see load()),
+   * without recomputing the estimations. In this case, Quantity must
+   * be a type that can be copied byte per byte (e.g. double, RealVector).
+   *
+   * This class is a model of concepts::CSurfelLocalEstimator
+   *
+   * @see testIndexedEstimatorCache.cpp
+
+   * @tparam TEstimator any model of CSurfelLocalEstimator
+   * @tparam TIndexedSurface the type of indexed digital surface
+   * (e.g. IndexedDigitalSurface<Container>).
+   */
+  template <typename TEstimator, typename TIndexedSurface>
+  class IndexedEstimatorCache
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    ///Estimator type
+    typedef TEstimator Estimator;
+    BOOST_CONCEPT_ASSERT(( concepts::CSurfelLocalEstimator<TEstimator> ));
+
+    ///Indexed surface type
+    typedef TIndexedSurface IndexedSurface;
+
+    ///Vertex type (the number of a surfel)
+    typedef typename IndexedSurface::Vertex Vertex;
+
+    ///Surfel type
+    typedef typename Estimator::Surfel Surfel;
+
+    ///Quantity type
+    typedef typename Estimator::Quantity Quantity;
+
+    ///Size type
+    typedef typename std::vector<Quantity>::size_type Size;
+
+    ///Self
+    typedef IndexedEstimatorCache<Estimator,IndexedSurface> Self;
+
+    /**
+     * Default constructor. The object is not valid.
+     */
+    IndexedEstimatorCache(): myEstimator( 0 ), myIndexedSurface( 0 ),
+                             myH( 1.0 ), myNbCached( 0 ), myInit( false )
+    {}
+
+    /**
+     * Constructor from estimator and indexed surface instances.
+     *
+     * @param anEstimator the estimator whose values are cached.
+     * @param aSurface the indexed surface giving the numbering of surfels.
+     */
+    IndexedEstimatorCache( Alias<Estimator> anEstimator,
+                           ConstAlias<IndexedSurface> aSurface )
+      : myEstimator( &anEstimator ), myIndexedSurface( &aSurface ),
+        myH( 1.0 ), myNbCached( 0 ), myInit( false )
+    {}
+
+    /**
+     * Destructor.
+     */
+    ~IndexedEstimatorCache()
+    {}
+
+    // ----------------------- CSurfelLocalEstimator Interface --------------------------------------
+
+    /**
+     * Estimator initialization. This method initializes the underlying
+     * estimator and caches all estimated quantity between @a itb and @a ite.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param[in] aH the gridstep
+     * @param[in] itb iterator on the first surfel of the surface.
+     * @param[in] ite iterator after the last surfel of the surface.
+     */
+    template <typename SurfelConstIterator>
+    void init(const double aH, SurfelConstIterator itb, SurfelConstIterator ite)
+    {
+      initChunks( aH, itb, ite, false );
+    }
+
+    /**
+     * Same as init(), but when WITH_OPENMP is defined, the range is
+     * cut into chunks of consecutive surfels which are evaluated in
+     * parallel. The cached values are the same as with init.
+     *
+     * @warning The range eval method of the estimator (hence its
+     * shape predicate and functors) is then called concurrently by
+     * several threads, so it must be thread-safe. Use init otherwise.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param[in] aH the gridstep
+     * @param[in] itb iterator on the first surfel of the surface.
+     * @param[in] ite iterator after the last surfel of the surface.
+     */
+    template <typename SurfelConstIterator>
+    void initParallel(const double aH, SurfelConstIterator itb, SurfelConstIterator ite)
+    {
+      initChunks( aH, itb, ite, true );
+    }
+
+    /**
+     * Cached evaluation of the estimator at iterator @a it
+     *
+     * @pre init() or load() method must have been called first.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param [in] it the iterator to the surfel to estimate.
+     * @return the estimated quantity.
+     */
+    template <typename SurfelConstIterator>
+    Quantity eval(const SurfelConstIterator it) const
+    {
+      return this->eval( Surfel( *it ) );
+    }
+
+    /**
+     * Cached evaluation of the estimator at a surfel @a s
+     *
+     * @pre init() or load() method must have been called first.
+     *
+     * @param [in] s the surfel to estimate.
+     * @return the estimated quantity.
+     */
+    Quantity eval(const Surfel s) const
+    {
+      return value( myIndexedSurface->vertex( s ) );
+    }
+
+    /**
+     * Cached range evaluation of the estimator between @a itb
+     * and @a ite.
+     *
+     * @pre init() or load() method must have been called first.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param [in] itb the begin iterator to the surfel to estimate.
+     * @param [in] ite the end iterator to the surfel to estimate.
+     * @param [in] result the output iterator of the estimated quantities.
+     * @return the output iterator after the last estimated quantity.
+     */
+    template <typename SurfelConstIterator,typename OutputIterator>
+    OutputIterator eval(SurfelConstIterator itb,
+                        SurfelConstIterator ite,
+                        OutputIterator result ) const
+    {
+      for(SurfelConstIterator it = itb; it != ite; ++it)
+        *result++ = this->eval(it);
+
+      return result;
+    }
+
+    /**
+     * @return the gridstep.
+     *
+     * @pre init() or load() method must have been called first.
+     */
+    double h() const
+    {
+      return myH;
+    }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Cached value at a vertex of the indexed surface.
+     *
+     * @pre init() or load() method must have been called first, and
+     * the surfel of @a v was in the estimated range.
+     *
+     * @param [in] v any vertex of the indexed surface.
+     * @return the estimated quantity.
+     */
+    const Quantity & value( const Vertex v ) const
+    {
+      ASSERT_MSG(myInit, " init() or load() method must have been called first.");
+      ASSERT( isCached( v ) );
+      return myValues[ v ];
+    }
+
+    /**
+     * @param [in] v any vertex of the indexed surface.
+     * @return 'true' iff a value has been estimated (or loaded) for @a v.
+     */
+    bool isCached( const Vertex v ) const
+    {
+      return myInit && ( myCached[ v ] != 0 );
+    }
+
+    /**
+     * @return the array of cached values, indexed by vertices (values
+     * of vertices that are not cached are default values).
+     */
+    const std::vector<Quantity> & values() const
+    {
+      return myValues;
+    }
+
+    /**
+     * @pre init() or load() method must have been called first.
+     * @return the number of cached elements.
+     */
+    Size size() const
+    {
+      ASSERT_MSG(myInit, " init() or load() method must have been called first.");
+      return myNbCached;
+    }
+
+    // ----------------------- Input / Output ---------------------------------
+  public:
+
+    /**
+     * Writes the gridstep and the cached values in binary form.
+     *
+     * @pre init() or load() method must have been called first.
+     * @param out the output stream.
+     */
+    void save( std::ostream & out ) const
+    {
+      ASSERT_MSG(myInit, " init() or load() method must have been called first.");
+      const DGtal::uint64_t nb = myValues.size();
+      const DGtal::uint32_t bytes = sizeof( Quantity );
+      out.write( reinterpret_cast<const char*>( &nb ), sizeof( nb ) );
+      out.write( reinterpret_cast<const char*>( &bytes ), sizeof( bytes ) );
+      out.write( reinterpret_cast<const char*>( &myH ), sizeof( myH ) );
+      if ( nb == 0 ) return;
+      out.write( reinterpret_cast<const char*>( &myCached[ 0 ] ),
+                 myCached.size() * sizeof( DGtal::uint8_t ) );
+      out.write( reinterpret_cast<const char*>( &myValues[ 0 ] ),
+                 myValues.size() * sizeof( Quantity ) );
+    }
+
+    /**
+     * Reads values previously written by \ref save, for the same
+     * indexed surface. The estimator is not used.
+     *
+     * @param in the input stream.
+     * @return 'true' if the values were successfully read, 'false'
+     * if the stream does not match the indexed surface or the
+     * quantity type (the cache is then unchanged).
+     */
+    bool load( std::istream & in )
+    {
+      ASSERT( myIndexedSurface );
+      DGtal::uint64_t nb = 0;
+      DGtal::uint32_t bytes = 0;
+      double h = 0.0;
+      in.read( reinterpret_cast<char*>( &nb ), sizeof( nb ) );
+      in.read( reinterpret_cast<char*>( &bytes ), sizeof( bytes ) );
+      in.read( reinterpret_cast<char*>( &h ), sizeof( h ) );
+      if ( ( ! in.good() ) || ( nb != myIndexedSurface->size() )
+           || ( bytes != sizeof( Quantity ) ) )
+        return false;
+      std::vector<DGtal::uint8_t> cached( nb );
+      std::vector<Quantity> values( nb );
+      if ( nb != 0 )
+        {
+          in.read( reinterpret_cast<char*>( &cached[ 0 ] ),
+                   cached.size() * sizeof( DGtal::uint8_t ) );
+          in.read( reinterpret_cast<char*>( &values[ 0 ] ),
+                   values.size() * sizeof( Quantity ) );
+        }
+      if ( in.fail() )
+        return false;
+      myCached.swap( cached );
+      myValues.swap( values );
+      myNbCached = std::count( myCached.begin(), myCached.end(), 1 );
+      myH = h;
+      myInit = true;
+      return true;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out<< "[IndexedEstimatorCache] number of surfels="<<myNbCached
+         << "/" << myValues.size();
+    }
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myEstimator && myIndexedSurface
+        && ( myValues.size() == myCached.size() );
+    }
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Initializes the underlying estimator and caches all estimated
+     * quantity between @a itb and @a ite, by chunks of consecutive
+     * surfels.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param[in] aH the gridstep
+     * @param[in] itb iterator on the first surfel of the surface.
+     * @param[in] ite iterator after the last surfel of the surface.
+     * @param[in] parallel when 'true' (and WITH_OPENMP is defined),
+     * the chunks are evaluated in parallel, otherwise the whole range
+     * is a single chunk.
+     */
+    template <typename SurfelConstIterator>
+    void initChunks(const double aH, SurfelConstIterator itb, SurfelConstIterator ite,
+                    const bool parallel)
+    {
+      ASSERT( myEstimator && myIndexedSurface );
+      //Surfel iterators are usually single pass: the range is copied
+      //once, then given to the estimator by chunks.
+      const std::vector<Surfel> surfels( itb, ite );
+      myEstimator->init( aH, surfels.begin(), surfels.end() );
+      myH = aH;
+      myValues.assign( myIndexedSurface->size(), Quantity() );
+      myCached.assign( myIndexedSurface->size(), 0 );
+      myNbCached = 0;
+
+      const long n = (long) surfels.size();
+#ifdef WITH_OPENMP
+      const long maxChunks = 8L * omp_get_max_threads();
+#else
+      const long maxChunks = 1L;
+#endif
+      const long nbChunks = std::min( n, parallel ? maxChunks : 1L );
+#ifdef WITH_OPENMP
+#pragma omp parallel if( parallel )
+#endif
+      {
+        std::vector<Quantity> chunkValues;
+#ifdef WITH_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for ( long c = 0; c < nbChunks; ++c )
+          {
+            const long b = ( n * c ) / nbChunks;
+            const long e = ( n * ( c + 1 ) ) / nbChunks;
+            chunkValues.clear();
+            myEstimator->eval( surfels.begin() + b, surfels.begin() + e,
+                               std::back_inserter( chunkValues ) );
+            for ( long i = b; i < e; ++i )
+              {
+                const Vertex v = myIndexedSurface->vertex( surfels[ i ] );
+                myValues[ v ] = chunkValues[ i - b ];
+                myCached[ v ] = 1;
+              }
+          }
+      }
+      myNbCached = std::count( myCached.begin(), myCached.end(), 1 );
+      myInit = true;
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Alias of the estimator
+    Estimator *myEstimator;
+
+    ///Alias of the indexed surface
+    const IndexedSurface *myIndexedSurface;
+
+    ///Cached values, indexed by vertices
+    std::vector<Quantity> myValues;
+
+    ///Flags of cached vertices (bytes, since they are written in parallel)
+    std::vector<DGtal::uint8_t> myCached;
+
+    ///Gridstep
+    double myH;
+
+    ///Number of cached values
+    Size myNbCached;
+
+    ///Init flag
+    bool myInit;
+
+  }; // end of class IndexedEstimatorCache
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'IndexedEstimatorCache'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'IndexedEstimatorCache' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename T, typename TS>
+  std::ostream&
+  operator<< ( std::ostream & out, const IndexedEstimatorCache<T,TS> & object )
+  {
+    object.selfDisplay( out );
+    return out;
+  }
+
+} // namespace DGtal
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IndexedEstimatorCache_h
+
+#undef IndexedEstimatorCache_RECURSES
+#endif // else defined(IndexedEstimatorCache_RECURSES)
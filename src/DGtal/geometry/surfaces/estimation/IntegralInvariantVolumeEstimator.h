@@ -288,6 +288,37 @@ public:
                        SurfelConstIterator ite,
                        OutputIterator result ) const;
 
+  /**
+  * -- Estimation --
+  *
+  * Same as eval( itb, ite, result ), but when WITH_OPENMP is defined,
+  * the range is cut into chunks of consecutive surfels which are
+  * evaluated in parallel (each chunk starts with the full kernel,
+  * then uses the shifting masks). The results are the same as with
+  * eval.
+  *
+  * @warning The point predicate (the shape) and the VolumeFunctor
+  * are then called concurrently by several threads, so they must be
+  * thread-safe (e.g. no mutable cache). Use eval otherwise.
+  *
+  * @tparam OutputIterator type of random access iterator of an array of Quantity
+  * @tparam SurfelConstIterator type of random access iterator on a Surfel
+  *
+  * @param[in] itb iterator defining the start of the range of surfels
+  * where we wish to compute some geometric information.
+  *
+  * @param[in] ite iterator defining the end of the range of surfels
+  * where we wish to compute some geometric information.
+  *
+  * @param[in] result random access iterator on the results, which
+  * must have room for all the surfels of the range.
+  * @return the updated output iterator after all outputs.
+  */
+  template <typename OutputIterator, typename SurfelConstIterator>
+  OutputIterator evalParallel( SurfelConstIterator itb,
+                               SurfelConstIterator ite,
+                               OutputIterator result ) const;
+
   /**
   * Writes/Displays the object on an output stream.
   * @param out the output stream where the object is written.
@@ -47,6 +47,7 @@
 #include "DGtal/math/linalg/EigenDecomposition.h"
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
 #include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/CellHashContainerTraits.h"
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
 #include "DGtal/geometry/volumes/estimation/VoronoiCovarianceMeasure.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -118,7 +119,7 @@ namespace DGtal
       VectorN trivialNormal;
     };
     typedef std::map<Point,EigenStructure> Point2EigenStructure;  ///< the map Point -> EigenStructure
-    typedef std::map<Surfel,Normals>           Surfel2Normals;    ///< the map Surfel -> Normals
+    typedef typename CellHashContainerTraits<KSpace>::template SurfelHashMap<Normals>::Type Surfel2Normals; ///< the (hash) map Surfel -> Normals
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -188,7 +189,8 @@ namespace DGtal
     template <typename PointOutputIterator>
     PointOutputIterator getPoints( PointOutputIterator outIt, Surfel s ) const; 
 
-    /// @return a const-reference to the map Surfel -> Normals (vcm and trivial normal).
+    /// @return a const-reference to the map Surfel -> Normals (vcm and trivial normal),
+    /// a hash map whose iteration order is unspecified.
     const Surfel2Normals& mapSurfel2Normals() const;
 
     /// @return a const-reference to the map Point ->
@@ -74,6 +74,8 @@ namespace DGtal
    * Eucliean metric (the distance is computed on both true and false points from the point
    * predicate in the given domain).
    *
+   * @see KanungoNoiseGenerator to draw many noisy objects in parallel.
+   *
    * @tparam TPointPredicate any model of point predicate concept (concepts::CPointPredicate)
    * @tparam TDomain any model of CDomain
    * @tparam TDigitalSetContainer container type to store the point predicate (default: DigitalSetBySTLSet)
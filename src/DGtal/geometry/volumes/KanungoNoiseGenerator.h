@@ -0,0 +1,235 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file KanungoNoiseGenerator.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module KanungoNoiseGenerator.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(KanungoNoiseGenerator_RECURSES)
+#error Recursive header files inclusion detected in KanungoNoiseGenerator.h
+#else // defined(KanungoNoiseGenerator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define KanungoNoiseGenerator_RECURSES
+
+#if !defined KanungoNoiseGenerator_h
+/** Prevents repeated inclusion of headers. */
+#define KanungoNoiseGenerator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KanungoNoiseGenerator
+  /**
+   * Description of template class 'KanungoNoiseGenerator' <p>
+   * \brief Aim: Generates many noisy versions of a point predicate
+   * with the Kanungo noise model of KanungoNoise, in parallel.
+   *
+   * The distances of the points of the domain to the border of the
+   * predicate (Euclidean distance transformations of the predicate
+   * and of its complement) are computed once at construction, and
+   * each call to generate() draws a new noisy object for a given
+   * noise parameter @f$ \alpha @f$ and a given seed: the label of a
+   * point at distance @f$ d @f$ is reverted with probability
+   * @f$ \alpha^{1+d} @f$.
+   *
+   * The random numbers are given by a counter-based generator: the
+   * number drawn for a point is a hash of the seed and of the index of
+   * the point in the domain. A noisy object only depends on the seed,
+   * not on the number of threads nor on the order in which points are
+   * processed. Points are processed 64 at a time, one word of the
+   * output DigitalSetByBitVector per iteration, with OpenMP when
+   * available. Points too far from the border to be reverted are not
+   * drawn.
+   *
+   * @code
+   * KanungoNoiseGenerator<Z3i::DigitalSet, Z3i::Domain> generator( set, domain );
+   * DigitalSetByBitVector<Z3i::Domain> noisy( domain );
+   * for ( DGtal::uint64_t seed = 0; seed < 1000; ++seed )
+   *   {
+   *     generator.generate( 0.5, seed, noisy );
+   *     ...
+   *   }
+   * @endcode
+   *
+   * @tparam TPointPredicate any model of point predicate concept (concepts::CPointPredicate)
+   * @tparam TDomain a HyperRectDomain.
+   *
+   * @see KanungoNoise, testKanungo.cpp
+   */
+  template <typename TPointPredicate, typename TDomain>
+  class KanungoNoiseGenerator
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    ///Concept checks
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain< TDomain > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+
+    ///Object type
+    typedef TPointPredicate PointPredicate;
+
+    ///Domain type
+    typedef TDomain Domain;
+
+    ///Point type
+    typedef typename TDomain::Point Point;
+
+    ///Output set type
+    typedef DigitalSetByBitVector<Domain> DigitalSet;
+
+    ///Word type of the output set
+    typedef typename DigitalSet::Word Word;
+
+    /**
+     * Constructor.
+     * Computes the distance transformations of the predicate and of
+     * its complement in the domain.
+     *
+     * @param aPredicate input point predicate defining the input objects.
+     * @param aDomain domain used for the distance transformation computation.
+     */
+    KanungoNoiseGenerator( ConstAlias<PointPredicate> aPredicate,
+                           ConstAlias<Domain> aDomain );
+
+    /**
+     * Destructor.
+     */
+    ~KanungoNoiseGenerator();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Draws a noisy version of the input predicate.
+     *
+     * @param anAlpha noise parameter between ]0,1[.
+     * @param aSeed the seed of the noise.
+     * @param[out] aSet the noisy object, its domain is the domain of
+     * the generator.
+     */
+    void generate( const double anAlpha,
+                   const DGtal::uint64_t aSeed,
+                   DigitalSet & aSet ) const;
+
+    /**
+     * Counter-based random generator.
+     *
+     * @param aSeed a seed.
+     * @param anIndex a counter (e.g. the index of a point).
+     * @return a number uniformly distributed in [0,1), function of
+     * the seed and of the counter only.
+     */
+    static double uniform( const DGtal::uint64_t aSeed,
+                           const DGtal::uint64_t anIndex );
+
+    /**
+     * @return the domain of the generator.
+     */
+    const Domain & domain() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    KanungoNoiseGenerator ( const KanungoNoiseGenerator & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    KanungoNoiseGenerator & operator= ( const KanungoNoiseGenerator & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    ///Reference to the domain
+    const Domain & myDomain;
+
+    ///The input predicate, one bit per point of the domain
+    DigitalSet myInput;
+
+    ///1 + distance to the border of each point of the domain, in the
+    ///order of the domain
+    std::vector<float> myDistances;
+
+  }; // end of class KanungoNoiseGenerator
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'KanungoNoiseGenerator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'KanungoNoiseGenerator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TP, typename TD>
+  std::ostream&
+  operator<< ( std::ostream & out, const KanungoNoiseGenerator<TP,TD> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/KanungoNoiseGenerator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined KanungoNoiseGenerator_h
+
+#undef KanungoNoiseGenerator_RECURSES
+#endif // else defined(KanungoNoiseGenerator_RECURSES)
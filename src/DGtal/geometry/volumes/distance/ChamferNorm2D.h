@@ -461,7 +461,7 @@ namespace DGtal
       /**
        * @return the begin iterator to the mask direction set
        */
-      ConstIterator begin()
+      ConstIterator begin() const
       {
         return myDirections.begin();
       }
@@ -469,7 +469,7 @@ namespace DGtal
       /**
        * @return the end iterator to the mask direction set
        */
-      ConstIterator end()
+      ConstIterator end() const
       {
         return myDirections.end();
       }
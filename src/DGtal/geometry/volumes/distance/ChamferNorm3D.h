@@ -0,0 +1,345 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChamferNorm3D.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ChamferNorm3D.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ChamferNorm3D_RECURSES)
+#error Recursive header files inclusion detected in ChamferNorm3D.h
+#else // defined(ChamferNorm3D_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChamferNorm3D_RECURSES
+
+#if !defined ChamferNorm3D_h
+/** Prevents repeated inclusion of headers. */
+#define ChamferNorm3D_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace experimental
+  {
+    /////////////////////////////////////////////////////////////////////////////
+    // template class ChamferNorm3D
+    /**
+     * Description of template class 'ChamferNorm3D' <p>
+     * \brief Aim: implements chamfer norms in dimension 3, as models
+     * of CMetricSpace and CPowerMetric.
+     *
+     * Contrary to ChamferNorm2D, this class is not a model of
+     * CSeparableMetric nor CPowerSeparableMetric, and cannot be used
+     * by the separable volumetric tools (DistanceTransformation,
+     * VoronoiMap, PowerMap, ReverseDistanceTransformation): a 3D
+     * chamfer distance is not a function of the distance in a
+     * coordinate plane and of the distance to this plane, and the
+     * points of a row closer to a site v than to a site u may not be
+     * a half-line. The exact chamfer distance transformation of a set
+     * of sites is computed by GeodesicDistanceTransformation, with
+     * the sites as sources (in a box, the geodesic distance is the
+     * chamfer distance).
+     *
+     * The mask is given by its vectors with nonnegative coordinates
+     * and their (integer) weights, and is made symmetric w.r.t. the
+     * coordinate planes. The unit ball of the norm is the convex hull
+     * of the mask vectors divided by their weights. Its facets are
+     * computed once in the constructor, as the vertices of the polar
+     * polytope: the raw distance of a vector v is then the maximum of
+     * @f$ \langle n, |v| \rangle @f$ over the (integer) facet normals
+     * n with nonnegative coordinates, i.e. the weight of a shortest
+     * path of mask vectors for a regular mask. If the normals are not
+     * integers, they are scaled by the lcm of their denominators, so
+     * that the raw distances are integers; the raw distance of a mask
+     * vector is then its weight times rawScale(). Power distances are
+     * raw distances minus the weight of the site.
+     *
+     * @code
+     * typedef experimental::ChamferNorm3D<Z3i::Space> Norm;
+     * Norm norm = Norm::mask5x5x5();
+     * typedef functors::TruePointPredicate<Z3i::Point> Predicate;
+     * GeodesicDistanceTransformation<Predicate, Norm> dt( domain, Predicate(), norm );
+     * dt.compute( sites.begin(), sites.end() );
+     * @endcode
+     *
+     * @tparam TSpace a model CSpace of dimension 3.
+     *
+     * @see ChamferNorm2D, GeodesicDistanceTransformation, testChamferNorm3D.cpp
+     */
+    template <typename TSpace>
+    class ChamferNorm3D
+    {
+      // ----------------------- Standard services ------------------------------
+    public:
+
+      BOOST_CONCEPT_ASSERT(( concepts::CSpace<TSpace> ));
+      BOOST_STATIC_ASSERT( TSpace::dimension == 3 );
+
+      ///Underlying Space
+      typedef TSpace Space;
+
+      ///Type for vectors
+      typedef typename Space::Vector Vector;
+      ///Type for points
+      typedef typename Space::Point Point;
+
+      ///Container for set of directions
+      typedef std::vector< Vector > Directions;
+      typedef typename Directions::const_iterator ConstIterator;
+
+      ///Value type for embedded distance evaluation
+      typedef double Value;
+      ///Value type for exact distance evaluation
+      typedef typename Space::Integer RawValue;
+      ///Weight type for power distances
+      typedef RawValue Weight;
+
+      ///Vector components type
+      typedef typename Vector::Component Abscissa;
+
+      /**
+       * Constructor from a mask.
+       *
+       * @param aDirectionSet the vectors of the mask with nonnegative
+       * coordinates (e.g. (1,0,0), (0,1,0), (0,0,1), (1,1,0), ...).
+       * The mask is made symmetric w.r.t. the coordinate planes.
+       * @param aWeights the weight of each vector.
+       * @param norm the normalization factor of the mask, the distance
+       * being the raw distance divided by this factor and by
+       * rawScale() (default is 1.0).
+       *
+       * @throw InputException if the sizes differ, if a vector is null
+       * or has a negative coordinate, if a weight is not positive, or
+       * if the mask does not define a norm.
+       */
+      ChamferNorm3D( const Directions & aDirectionSet,
+                     const std::vector<RawValue> & aWeights,
+                     const Value norm = 1.0 );
+
+      /**
+       * Destructor.
+       */
+      ~ChamferNorm3D();
+
+      /**
+       * @return the 3x3x3 mask <3,4,5> (normalization factor 3).
+       */
+      static ChamferNorm3D mask3x3x3();
+
+      /**
+       * @return the 5x5x5 mask <7,10,12,16,17,21> (normalization
+       * factor 7).
+       */
+      static ChamferNorm3D mask5x5x5();
+
+      // ----------------------- CMetricSpace concept -----------------------------------
+    public:
+
+      /**
+       * Returns the distance for the chamfer norm between P and Q.
+       *
+       * @param P a point
+       * @param Q a point
+       *
+       * @return the distance between P and Q.
+       */
+      Value operator()( const Point & P, const Point & Q ) const;
+
+      /**
+       * Returns the raw distance for the chamfer norm between P and Q,
+       * i.e. the un-normalized integer distance.
+       *
+       * @param P a point
+       * @param Q a point
+       *
+       * @return the raw distance between P and Q.
+       */
+      RawValue rawDistance( const Point & P, const Point & Q ) const;
+
+      /**
+       * Given an origin and two points, this method decides which one
+       * is closest to the origin.
+       *
+       * @param origin the origin
+       * @param first  the first point
+       * @param second the second point
+       *
+       * @return a Closest enum: FIRST, SECOND or BOTH.
+       */
+      DGtal::Closest closest( const Point & origin,
+                              const Point & first,
+                              const Point & second ) const;
+
+      // ----------------------- CPowerMetric concept -----------------------------------
+
+      /**
+       * Returns the power distance of a point to a weighted site.
+       *
+       * @param aPoint a point
+       * @param aQ a site
+       * @param aWq the weight of the site
+       *
+       * @return the raw distance between aPoint and aQ minus aWq.
+       */
+      Weight powerDistance( const Point & aPoint,
+                            const Point & aQ,
+                            const Weight & aWq ) const;
+
+      /**
+       * Given an origin and two weighted points, this method decides
+       * which one is closest to the origin for the power distance.
+       *
+       * @param origin the origin
+       * @param first  the first point
+       * @param wF the weight of the first point
+       * @param second the second point
+       * @param wS the weight of the second point
+       *
+       * @return a Closest enum: FIRST, SECOND or BOTH.
+       */
+      DGtal::Closest closestPower( const Point & origin,
+                                   const Point & first,
+                                   const Weight & wF,
+                                   const Point & second,
+                                   const Weight & wS ) const;
+
+      // ------------------------- Mask services ------------------------------
+    public:
+
+      /**
+       * @return the begin iterator to the mask direction set (vectors
+       * with nonnegative coordinates).
+       */
+      ConstIterator begin() const;
+
+      /**
+       * @return the end iterator to the mask direction set
+       */
+      ConstIterator end() const;
+
+      /**
+       * @return the mask size
+       */
+      unsigned int size() const;
+
+      /**
+       * @return the facet normals of the unit ball with nonnegative
+       * coordinates (scaled to integers).
+       */
+      const Directions & normals() const;
+
+      /**
+       * @return the factor between the raw distance of a mask vector
+       * and its weight (1 if the facet normals are integers).
+       */
+      RawValue rawScale() const;
+
+      // ------------------------- Other services ------------------------------
+    public:
+
+      /**
+       * Writes/Displays the object on an output stream.
+       * @param out the output stream where the object is written.
+       */
+      void selfDisplay ( std::ostream & out ) const;
+
+      /**
+       * Checks the validity/consistency of the object.
+       * @return 'true' if the raw distance of each mask vector is its
+       * weight (times rawScale()), 'false' otherwise.
+       */
+      bool isValid() const;
+
+      // ------------------------- Internals ------------------------------------
+    private:
+
+      /**
+       * Computes the facet normals of the unit ball.
+       */
+      void computeNormals();
+
+      /**
+       * Adds a vector and its distinct coordinate permutations to a
+       * mask.
+       *
+       * @param aDirections the vectors of the mask.
+       * @param aWeights the weights of the mask vectors.
+       * @param aVector a vector with nonnegative coordinates.
+       * @param aWeight its weight.
+       */
+      static void addPermutations( Directions & aDirections,
+                                   std::vector<RawValue> & aWeights,
+                                   const Vector & aVector,
+                                   const RawValue aWeight );
+
+      // ------------------------- Private Datas --------------------------------
+    private:
+
+      ///Vectors of the mask (nonnegative coordinates)
+      Directions myDirections;
+      ///Weights of the mask vectors
+      std::vector<RawValue> myWeights;
+      ///Facet normals of the unit ball (nonnegative coordinates)
+      Directions myNormals;
+      ///Scale between the raw distances and the weights
+      RawValue myRawScale;
+      ///Normalization factor
+      Value myNorm;
+
+    }; // end of class ChamferNorm3D
+
+  } // namespace experimental
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ChamferNorm3D'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ChamferNorm3D' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename T>
+  std::ostream&
+  operator<< ( std::ostream & out, const experimental::ChamferNorm3D<T> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/ChamferNorm3D.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChamferNorm3D_h
+
+#undef ChamferNorm3D_RECURSES
+#endif // else defined(ChamferNorm3D_RECURSES)
@@ -0,0 +1,329 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompactPowerMap.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module CompactPowerMap.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CompactPowerMap_RECURSES)
+#error Recursive header files inclusion detected in CompactPowerMap.h
+#else // defined(CompactPowerMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompactPowerMap_RECURSES
+
+#if !defined CompactPowerMap_h
+/** Prevents repeated inclusion of headers. */
+#define CompactPowerMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/geometry/volumes/distance/CPowerSeparableMetric.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompactPowerMap
+  /**
+   * Description of template class 'CompactPowerMap' <p>
+   * \brief Aim: Power map computed as PowerMap, but with a compact
+   * storage of the sites and of their weights.
+   *
+   * PowerMap stores the closest site of each point as a point of the
+   * space, and reads the weights of the sites in the weight image at
+   * each step of the computation. This class numbers the weighted
+   * points once, copies their coordinates and weights in two arrays,
+   * and stores for each point of the domain the number of its closest
+   * site, as an integer of type @a TIndex. For 32 bits integers in
+   * dimension 3, the map is three times smaller than the one of
+   * PowerMap, and the weights are read in an array whatever the
+   * weight image is (e.g. an ImageContainerBySTLMap).
+   *
+   * The power map is the same as the one of PowerMap (in particular
+   * for equi-distant sites), and its 1D steps are also computed in
+   * parallel when WITH_OPENMP is defined. The reverse distance
+   * transformation is given by powerDistance(), and the reduced
+   * medial axis is extracted by ReducedMedialAxis.
+   *
+   * This class is a model of CConstImage.
+   *
+   * @tparam TWeightImage model of CConstImage
+   * @tparam TPowerSeparableMetric model of CPowerSeparableMetric
+   * @tparam TIndex an unsigned integer type, able to number the
+   * weighted points (default: DGtal::uint32_t).
+   *
+   * @see PowerMap, ReducedMedialAxis, testCompactPowerMap.cpp
+   */
+  template < typename TWeightImage,
+             typename TPowerSeparableMetric,
+             typename TIndex = DGtal::uint32_t >
+  class CompactPowerMap
+  {
+
+  public:
+
+    BOOST_CONCEPT_ASSERT(( concepts::CConstImage< TWeightImage > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPowerSeparableMetric<TPowerSeparableMetric> ));
+
+    ///Copy of the weight image types
+    typedef TWeightImage WeightImage;
+    typedef typename TWeightImage::Value Weight;
+    typedef typename WeightImage::Domain::Space Space;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Size Size;
+    typedef typename Space::Point::Coordinate Abscissa;
+
+    ///Definition of the underlying domain type.
+    typedef HyperRectDomain<Space> Domain;
+
+    ///Power separable metric type
+    typedef TPowerSeparableMetric PowerSeparableMetric;
+
+    ///Type of the site numbers
+    typedef TIndex Index;
+
+    ///Definition of the image model value type.
+    typedef Vector Value;
+
+    ///Self type
+    typedef CompactPowerMap<TWeightImage, TPowerSeparableMetric, TIndex> Self;
+
+    ///Definition of the image constRange
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    /**
+     * Constructor.
+     *
+     * This constructor computes the power map of the points of
+     * positive weight of the weight image.
+     *
+     * All parameters are aliased in this class.
+     *
+     * @param aDomain defines the (hyper-rectangular) domain on which
+     * the computation is performed.
+     * @param aWeightImage an image returning the weight for some points
+     * @param aMetric a power separable metric instance.
+     *
+     * @throw InputException if there are more weighted points than
+     * @a TIndex can number.
+     */
+    CompactPowerMap( ConstAlias<Domain> aDomain,
+                     ConstAlias<WeightImage> aWeightImage,
+                     ConstAlias<PowerSeparableMetric> aMetric );
+
+    /**
+     * Default destructor
+     */
+    ~CompactPowerMap();
+
+  private:
+
+    CompactPowerMap( const CompactPowerMap & other );
+
+    CompactPowerMap & operator=( const CompactPowerMap & other );
+
+  public:
+    // ------------------- ConstImage model ------------------------
+
+    /**
+     * @return the power map domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a const range on the power map values.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * Access to the closest site of a point.
+     *
+     * @param aPoint the point to probe.
+     * @return its closest site, or a point outside the domain if
+     * there is no weighted point.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    // ------------------- Compact storage ------------------------
+
+    /**
+     * @param aPoint the point to probe.
+     * @return the number of its closest site, or nbSites() if there
+     * is no weighted point.
+     */
+    Index siteIndex( const Point & aPoint ) const;
+
+    /**
+     * @return the number of sites (weighted points).
+     */
+    Index nbSites() const;
+
+    /**
+     * @param i a site number (less than nbSites()).
+     * @return the site.
+     */
+    const Point & site( const Index i ) const;
+
+    /**
+     * @param i a site number (less than nbSites()).
+     * @return its weight.
+     */
+    const Weight & weight( const Index i ) const;
+
+    /**
+     * Reverse distance transformation value at a point, as
+     * ReverseDistanceTransformation::operator().
+     *
+     * @param aPoint the point to probe (with a closest site).
+     * @return the power distance to its closest site.
+     */
+    typename PowerSeparableMetric::Value powerDistance( const Point & aPoint ) const;
+
+    /**
+     * @return  Returns the underlying metric.
+     */
+    const PowerSeparableMetric* metricPtr() const;
+
+    /**
+     * @return  Returns the underlying weight image.
+     */
+    const WeightImage* weightImagePtr() const;
+
+    /**
+     * Self Display method.
+     *
+     * @param out output stream
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------- Private functions ------------------------
+  private:
+
+    /**
+     * Numbers the weighted points and computes the power map.
+     */
+    void compute();
+
+    /**
+     *  Compute the other steps of the separable power map.
+     *
+     * @param dim the dimension to process
+     */
+    void computeOtherSteps( const Dimension dim );
+
+    /**
+     * Given a power map valid at dimension @a dim-1, this method
+     * updates the map to make it consistent at dimension @a dim along
+     * the 1D span starting at @a row along the dimension @a dim.
+     *
+     * @param row starting point of the 1D process.
+     * @param dim dimension of the update.
+     * @param sites a scratch buffer for the sites of the row.
+     */
+    void computeOtherStep1D( const Point & row, const Dimension dim,
+                             std::vector<Index> & sites );
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its index in the domain order.
+     */
+    std::size_t linearize( const Point & aPoint ) const;
+
+    // ------------------- Private members ------------------------
+  private:
+
+    ///Pointer to the computation domain
+    const Domain * myDomainPtr;
+
+    ///Pointer to the separable metric instance
+    const PowerSeparableMetric * myMetricPtr;
+
+    ///Pointer to the weight image
+    const WeightImage * myWeightImagePtr;
+
+    ///Copy of the domain lower bound
+    Point myLowerBoundCopy;
+
+    ///Copy of the domain upper bound
+    Point myUpperBoundCopy;
+
+    ///Value to act as a +infinity value
+    Point myInfinity;
+
+    ///Offsets between consecutive points along each dimension
+    std::vector<std::size_t> myStrides;
+
+    ///The sites
+    std::vector<Point> mySites;
+
+    ///The weights of the sites
+    std::vector<Weight> myWeights;
+
+    ///The number of the closest site of each point of the domain
+    std::vector<Index> myIndices;
+
+  }; // end of class CompactPowerMap
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompactPowerMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompactPowerMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename W, typename Sep, typename I>
+  std::ostream&
+  operator<< ( std::ostream & out, const CompactPowerMap<W,Sep,I> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/CompactPowerMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompactPowerMap_h
+
+#undef CompactPowerMap_RECURSES
+#endif // else defined(CompactPowerMap_RECURSES)
@@ -0,0 +1,359 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DynamicVoronoiMap.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module DynamicVoronoiMap.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DynamicVoronoiMap_RECURSES)
+#error Recursive header files inclusion detected in DynamicVoronoiMap.h
+#else // defined(DynamicVoronoiMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DynamicVoronoiMap_RECURSES
+
+#if !defined DynamicVoronoiMap_h
+/** Prevents repeated inclusion of headers. */
+#define DynamicVoronoiMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DynamicVoronoiMap
+  /**
+   * Description of template class 'DynamicVoronoiMap' <p>
+   * \brief Aim: Voronoi map (and distance transformation) whose sites
+   * may be inserted and removed by batches, the map being repaired
+   * only where it changes.
+   *
+   * The map is first computed by VoronoiMap and stores, as VoronoiMap,
+   * the closest site of each point. A call to update repairs the map
+   * around the inserted and removed sites only:
+   * - the points whose closest site may change lie in the Voronoi
+   *   cells of the changed sites, among the former sites and these
+   *   sites. Such a cell is star-shaped around its site, and its
+   *   lattice points are found by a flood over the 2d-neighborhood
+   *   from the site, through the points close enough to the cell.
+   * - a point whose former site remains gets the closest of this site
+   *   and of the inserted sites whose flood reached it.
+   * - a point whose former site is removed gets its closest site by
+   *   brute force on the sites of a box around the cell of the removed
+   *   site, which contains the ball of the point to this site. The
+   *   boxes of a cluster of removed sites are merged.
+   *
+   * The repaired map is thus exact for any separable metric. The cost
+   * of an update is proportional to the size of the Voronoi cells of
+   * the changed sites, plus the size of the boxes around the cells of
+   * the removed sites times their number of sites. update also
+   * reports the points whose distance changed, and returns the number
+   * of repaired points.
+   *
+   * @code
+   * DynamicVoronoiMap<Z3i::Space, Z3i::L2Metric> vmap( domain, predicate, l2 );
+   * std::vector<Z3i::Point> inserted, removed, changed;
+   * ...
+   * vmap.update( inserted.begin(), inserted.end(), removed.begin(), removed.end(),
+   *              std::back_inserter( changed ) );
+   * @endcode
+   *
+   * @tparam TSpace type of Digital Space (model of CSpace).
+   * @tparam TSeparableMetric a model of CSeparableMetric.
+   *
+   * @see VoronoiMap, testDynamicVoronoiMap.cpp
+   */
+  template < typename TSpace, typename TSeparableMetric >
+  class DynamicVoronoiMap
+  {
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<TSeparableMetric> ));
+
+    typedef DynamicVoronoiMap<TSpace, TSeparableMetric> Self;
+    typedef TSpace Space;
+    typedef TSeparableMetric SeparableMetric;
+    typedef HyperRectDomain<Space> Domain;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Size Size;
+    typedef typename Space::Integer Integer;
+    ///Definition of the Voronoi map value type.
+    typedef Vector Value;
+    ///Definition of the distance type.
+    typedef typename SeparableMetric::Value Distance;
+    ///Type of the raw distances of the metric.
+    typedef typename SeparableMetric::RawValue RawValue;
+    ///Type of the image storing the closest sites.
+    typedef ImageContainerBySTLVector<Domain, Vector> OutputImage;
+    ///Definition of the image value range.
+    typedef typename OutputImage::ConstRange ConstRange;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Computes the Voronoi map with VoronoiMap.
+     *
+     * @tparam TPointPredicate a model of CPointPredicate.
+     * @param aDomain the (hyper-rectangular) domain.
+     * @param aPredicate the point predicate (the sites are the false points).
+     * @param aMetric the separable metric.
+     */
+    template <typename TPointPredicate>
+    DynamicVoronoiMap( ConstAlias<Domain> aDomain,
+                       const TPointPredicate & aPredicate,
+                       ConstAlias<SeparableMetric> aMetric );
+
+    /**
+     * Destructor.
+     */
+    ~DynamicVoronoiMap();
+
+  private:
+
+    DynamicVoronoiMap( const DynamicVoronoiMap & other );
+
+    DynamicVoronoiMap & operator=( const DynamicVoronoiMap & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the domain of the map.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a pointer to the metric.
+     */
+    const SeparableMetric* metric() const;
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return the closest site, or a point outside the domain if there
+     * is no site.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return its distance to the closest site.
+     * @pre there is at least one site.
+     */
+    Distance distance( const Point & aPoint ) const;
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return 'true' iff the point is a site.
+     */
+    bool isSite( const Point & aPoint ) const;
+
+    /**
+     * @return the range of the closest sites, in the domain order.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * Removes then inserts sites, repairs the map and outputs the
+     * points whose distance changed. Removed points which are not
+     * sites and inserted points which are already sites are ignored.
+     *
+     * @tparam TInsertIterator an iterator on points.
+     * @tparam TRemoveIterator an iterator on points.
+     * @tparam TOutputIterator an output iterator on points.
+     *
+     * @param itInsertedBegin begin of the inserted sites.
+     * @param itInsertedEnd end of the inserted sites.
+     * @param itRemovedBegin begin of the removed sites.
+     * @param itRemovedEnd end of the removed sites.
+     * @param itChanged (returns) the points whose distance changed,
+     * each output once.
+     * @return the number of points whose closest site was recomputed,
+     * i.e. the number of lattice points of the floods.
+     */
+    template <typename TInsertIterator, typename TRemoveIterator, typename TOutputIterator>
+    DGtal::uint64_t update( TInsertIterator itInsertedBegin, TInsertIterator itInsertedEnd,
+                 TRemoveIterator itRemovedBegin, TRemoveIterator itRemovedEnd,
+                 TOutputIterator itChanged );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Points repaired by an update.
+     */
+    struct RepairedPoints
+    {
+      /// The points.
+      std::vector<Point> points;
+      /// Their closest sites after the update.
+      std::vector<Value> sites;
+      /// The last flood which visited each point.
+      std::vector<unsigned int> floods;
+    };
+
+    /**
+     * @param aPoint any point of the domain.
+     * @param repaired the repaired points.
+     * @return the index of aPoint in the repaired points, or their
+     * number if it is not repaired.
+     */
+    std::size_t slot( const Point & aPoint,
+                      const RepairedPoints & repaired ) const;
+
+    /**
+     * Adds to the repaired points the lattice points of the Voronoi
+     * cell of a changed site, among the former sites and this site,
+     * and the points close to this cell.
+     *
+     * @param aSite an inserted or removed site.
+     * @param isInserted 'true' iff aSite is inserted.
+     * @param aFlood the index of the flood.
+     * @param neighborhood the vectors of the 2d-neighborhood.
+     * @param repaired (modified) the repaired points.
+     */
+    void flood( const Point & aSite, const bool isInserted,
+                const unsigned int aFlood,
+                const std::vector<Vector> & neighborhood,
+                RepairedPoints & repaired );
+
+    /**
+     * Adds a point to the repaired points, if it is not already
+     * repaired, and marks it as visited by a flood. An inserted site
+     * becomes the closest site of the point if it is closer than its
+     * current one.
+     *
+     * @param aPoint any point of the domain.
+     * @param isInserted 'true' iff aSite is inserted.
+     * @param aFlood the index of the flood.
+     * @param aSite the site of the flood.
+     * @param repaired (modified) the repaired points.
+     */
+    void visit( const Point & aPoint, const bool isInserted,
+                const unsigned int aFlood, const Point & aSite,
+                RepairedPoints & repaired );
+
+    /**
+     * Computes the closest sites after the update of some repaired
+     * points, by brute force on the sites of a larger box.
+     *
+     * @param aBox a box containing the points.
+     * @param points some repaired points.
+     * @param inserted the inserted sites.
+     * @param removed the removed sites, sorted.
+     * @param repaired (modified) the repaired points, whose closest
+     * sites are set for the given points (myInfinity if there is no
+     * site).
+     */
+    void computeSites( const Domain & aBox,
+                       const std::vector<Point> & points,
+                       const std::vector<Point> & inserted,
+                       const std::vector<Point> & removed,
+                       RepairedPoints & repaired ) const;
+
+    /**
+     * @param aBox any box.
+     * @return the number of points of aBox (Domain::size() may
+     * overflow).
+     */
+    static DGtal::uint64_t volume( const Domain & aBox );
+
+    /**
+     * Merges two boxes, and their points, while their bounding box is
+     * not larger than both boxes together.
+     *
+     * @param boxes the boxes.
+     * @param boxPoints the points of each box.
+     */
+    static void mergeBoxes( std::vector<Domain> & boxes,
+                            std::vector< std::vector<Point> > & boxPoints );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Pointer to the computation domain.
+    const Domain * myDomainPtr;
+    /// Pointer to the metric.
+    const SeparableMetric * myMetricPtr;
+    /// The closest sites.
+    OutputImage myImage;
+    /// Value of the points without site.
+    Point myInfinity;
+    /// Index of each point in the points repaired by an update (only
+    /// meaningful for these points).
+    std::vector<Size> mySlots;
+
+  }; // end of class DynamicVoronoiMap
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DynamicVoronoiMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DynamicVoronoiMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename TSep>
+  std::ostream&
+  operator<< ( std::ostream & out, const DynamicVoronoiMap<S,TSep> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/DynamicVoronoiMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DynamicVoronoiMap_h
+
+#undef DynamicVoronoiMap_RECURSES
+#endif // else defined(DynamicVoronoiMap_RECURSES)
@@ -0,0 +1,345 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ExactPredicateLinfSeparableMetric.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ExactPredicateLinfSeparableMetric.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ExactPredicateLinfSeparableMetric_RECURSES)
+#error Recursive header files inclusion detected in ExactPredicateLinfSeparableMetric.h
+#else // defined(ExactPredicateLinfSeparableMetric_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ExactPredicateLinfSeparableMetric_RECURSES
+
+#if !defined ExactPredicateLinfSeparableMetric_h
+/** Prevents repeated inclusion of headers. */
+#define ExactPredicateLinfSeparableMetric_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <functional>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/CSpace.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ExactPredicateLinfSeparableMetric
+  /**
+   * Description of template class 'ExactPredicateLinfSeparableMetric' <p>
+   * \brief Aim: implements the separable @f$ l_\infty @f$ metric with
+   * exact predicates.
+   *
+   * Given two points @f$ x=(x_0...x_{n-1})@f$, @f$ y=(y_0...y_{n-1})@f$,
+   * @f$ distance(x,y)= \max_{i} |x_i-y_i| @f$. The raw distance is the
+   * distance itself, stored in a @a TRawValue.
+   *
+   * The class is a model of CSeparableMetric and has the same row
+   * kernels as ExactPredicateLpSeparableMetric (partialRawDistances,
+   * closest and hiddenBy on abscissae and partial distances). The
+   * boundary between two Voronoi cells along a line is computed in
+   * @f$ O(1)@f$: the difference of the distances to two sites is
+   * piecewise linear along the line, with at most six breakpoints.
+   * Since cells of different sites may share whole intervals, hiddenBy
+   * checks that v is strictly closer than both u and w somewhere on
+   * the line.
+   *
+   * @tparam TSpace the model of CSpace on which the metric is
+   * defined.
+   * @tparam TRawValue model of CSignedInteger used to store raw
+   * distances (default: DGtal::int64_t)
+   *
+   * @see ExactPredicateLpSeparableMetric
+   */
+  template <typename TSpace, typename TRawValue=DGtal::int64_t>
+  class ExactPredicateLinfSeparableMetric
+    : public std::binary_function< typename TSpace::Point, typename TSpace::Point, double >
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef std::binary_function< typename TSpace::Point, typename TSpace::Point, double > Base;
+    typedef typename Base::first_argument_type first_argument_type;
+    typedef typename Base::second_argument_type second_argument_type;
+    typedef typename Base::result_type result_type;
+
+    ///Copy the space type
+    typedef TSpace Space;
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace<TSpace> ));
+
+    ///Type for points
+    typedef typename Space::Point Point;
+    ///Type for points
+    typedef typename Point::Coordinate Abscissa;
+    ///Type for vectors
+    typedef typename Space::Vector Vector;
+    ///Type for dimensions
+    typedef typename Space::Dimension Dimension;
+
+    ///Type for internal distance values
+    typedef TRawValue RawValue;
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<RawValue> ));
+
+    ///Type for distance values
+    typedef double Value;
+
+    ///Self type
+    typedef ExactPredicateLinfSeparableMetric<TSpace,RawValue> Self;
+
+    /**
+     * Constructor.
+     */
+    ExactPredicateLinfSeparableMetric();
+
+    /**
+     * Destructor.
+     */
+    ~ExactPredicateLinfSeparableMetric();
+
+    /**
+     * Copy constructor.
+     * UNUSED_PARAM other the object to clone.
+     */
+    ExactPredicateLinfSeparableMetric ( const Self & UNUSED(other) ) {}
+
+    /**
+     * Assignment.
+     * UNUSED_PARAM other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator= ( const Self & UNUSED(other) ) { return *this; }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    // ----------------------- CMetricSpace --------------------------------------
+    /**
+     * Compute the distance between @a aP and @a aQ.
+     *
+     * @param aP a first point.
+     * @param aQ a second point.
+     *
+     * @return the distance between aP and aQ.
+     */
+    Value operator()(const Point & aP, const Point &aQ) const;
+
+    /**
+     * Given an origin and two points, this method decides which one
+     * is closest to the origin.
+     *
+     * @param origin the origin
+     * @param first  the first point
+     * @param second the second point
+     *
+     * @return a Closest enum: FIRST, SECOND or BOTH.
+     */
+    Closest closest(const Point &origin,
+                    const Point &first,
+                    const Point &second) const;
+
+    /**
+     * Compute the raw distance between @a aP and @a aQ
+     * (i.e. @f$ \max_i |x_i-y_i |\f$).
+     *
+     * @param aP a first point.
+     * @param aQ a second point.
+     *
+     * @return the distance between aP and aQ.
+     */
+    RawValue rawDistance(const Point & aP, const Point &aQ) const;
+
+    /**
+     * Compute the raw distance between @a aP and @a aQ, discarding
+     * the term along dimension @a dim (i.e. @f$ \max_{i\neq dim}
+     * |x_i-y_i |\f$).
+     *
+     * @param aP a first point.
+     * @param aQ a second point.
+     * @param dim the discarded dimension.
+     *
+     * @return the partial raw distance between aP and aQ.
+     */
+    RawValue partialRawDistance(const Point & aP, const Point &aQ,
+                                const Dimension dim) const;
+
+    /**
+     * Compute the partial raw distances of the sites [itb,ite) to the
+     * row starting at @a startingPoint along dimension @a dim.
+     *
+     * @param itb pointer to the first site.
+     * @param ite pointer after the last site.
+     * @param startingPoint starting point of the row.
+     * @param dim direction of the row.
+     * @param out [out] the partial raw distances (as many as sites).
+     */
+    void partialRawDistances(const Point * itb, const Point * ite,
+                             const Point & startingPoint,
+                             const Dimension dim,
+                             RawValue * out) const;
+
+    /**
+     * Given a point at abscissa @a x on a row and two sites of partial
+     * raw distances @a nu and @a nv to the row, decides which one is
+     * closest to the point.
+     *
+     * @param x abscissa of the point.
+     * @param udim abscissa of the first site.
+     * @param nu partial raw distance of the first site.
+     * @param vdim abscissa of the second site.
+     * @param nv partial raw distance of the second site.
+     *
+     * @return a Closest enum: FIRST, SECOND or BOTH.
+     */
+    Closest closest(const Abscissa x,
+                    const Abscissa udim, const RawValue nu,
+                    const Abscissa vdim, const RawValue nv) const;
+
+    // ----------------------- CSeparableMetric --------------------------------------
+    /**
+     * Given three sites (u,v,w) and a straight segment
+     * [startingPoint,endPoint] along dimension dim, we detect if the
+     * voronoi cells of @a u and @a w strictly hide the voronoi cell of @a v on the
+     * straight line. This method is in @f$ O(1)@f$.
+     *
+     * @pre u,v and w must be such that u[dim] < v[dim] < w[dim]
+     *
+     * @param u a site
+     * @param v a site
+     * @param w a site
+     * @param startingPoint starting point of the segment
+     * @param endPoint end point of the segment
+     * @param dim direction of the straight line
+     *
+     * @return true if (u,w) hides v (strictly).
+     */
+    bool hiddenBy(const Point &u,
+                  const Point &v,
+                  const Point &w,
+                  const Point &startingPoint,
+                  const Point &endPoint,
+                  const typename Point::UnsignedComponent dim) const;
+
+    /**
+     * Same as hiddenBy above, the sites being given by their abscissae
+     * and partial raw distances to the row [lower,upper].
+     *
+     * @pre udim < vdim < wdim
+     *
+     * @param udim abscissa of u
+     * @param nu partial raw distance of u
+     * @param vdim abscissa of v
+     * @param nv partial raw distance of v
+     * @param wdim abscissa of w
+     * @param nw partial raw distance of w
+     * @param lower abscissa of the starting point of the row
+     * @param upper abscissa of the end point of the row
+     *
+     * @return true if (u,w) hides v (strictly).
+     */
+    bool hiddenBy(const Abscissa udim, const RawValue nu,
+                  const Abscissa vdim, const RawValue nv,
+                  const Abscissa wdim, const RawValue nw,
+                  const Abscissa lower, const Abscissa upper) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Returns the greatest abscissa @a q of the interval [lower,upper]
+     * such that du(q) - dv(q) < threshold, du and dv being the
+     * distances to u and v (threshold 0 gives the greatest point
+     * strictly closer to u, threshold 1 the greatest point not
+     * strictly closer to v).
+     *
+     * @pre udim < vdim and du(lower) - dv(lower) < threshold.
+     *
+     * @param udim coordinate of u along dimension dim
+     * @param vdim coordinate of v along dimension dim
+     * @param nu partial raw distance of u
+     * @param nv partial raw distance of v
+     * @param lower interval lower bound
+     * @param upper interval upper bound
+     * @param threshold the threshold.
+     *
+     * @return the greatest such abscissa.
+     */
+    Abscissa bisector(const Abscissa udim,
+                      const Abscissa vdim,
+                      const RawValue nu,
+                      const RawValue nv,
+                      const Abscissa lower,
+                      const Abscissa upper,
+                      const RawValue threshold) const;
+
+    /**
+     * @param x an abscissa on the row.
+     * @param udim abscissa of a site.
+     * @param nu partial raw distance of the site.
+     * @return the raw distance between the site and the point at @a x.
+     */
+    static RawValue distance(const Abscissa x, const Abscissa udim, const RawValue nu);
+
+  }; // end of class ExactPredicateLinfSeparableMetric
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ExactPredicateLinfSeparableMetric'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ExactPredicateLinfSeparableMetric' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename T, typename P>
+  std::ostream&
+  operator<< ( std::ostream & out, const ExactPredicateLinfSeparableMetric<T,P> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/ExactPredicateLinfSeparableMetric.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ExactPredicateLinfSeparableMetric_h
+
+#undef ExactPredicateLinfSeparableMetric_RECURSES
+#endif // else defined(ExactPredicateLinfSeparableMetric_RECURSES)
@@ -52,6 +52,64 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /**
+     * Compile-time exponentiation by squaring: LpPower<T,p>::get(x)
+     * returns @f$ x^p @f$ with a sequence of multiplications unrolled
+     * at compile time.
+     *
+     * @tparam T the value type.
+     * @tparam p the exponent.
+     */
+    template <typename T, DGtal::uint32_t p>
+    struct LpPower
+    {
+      static T get( const T & x )
+      {
+        const T h = LpPower<T, p / 2>::get( x );
+        return ( p % 2 == 1 ) ? h * h * x : h * h;
+      }
+    };
+    template <typename T>
+    struct LpPower<T, 1>
+    {
+      static T get( const T & x ) { return x; }
+    };
+    template <typename T>
+    struct LpPower<T, 0>
+    {
+      static T get( const T & ) { return NumberTraits<T>::ONE; }
+    };
+
+    /**
+     * LpRoot<p>::get(x) returns @f$ x^{1/p} @f$, without std::pow for
+     * p = 1, 2 and 4.
+     *
+     * @tparam p the exponent.
+     */
+    template <DGtal::uint32_t p>
+    struct LpRoot
+    {
+      static double get( const double x ) { return std::pow( x, 1.0 / (double) p ); }
+    };
+    template <>
+    struct LpRoot<1>
+    {
+      static double get( const double x ) { return x; }
+    };
+    template <>
+    struct LpRoot<2>
+    {
+      static double get( const double x ) { return std::sqrt( x ); }
+    };
+    template <>
+    struct LpRoot<4>
+    {
+      static double get( const double x ) { return std::sqrt( std::sqrt( x ) ); }
+    };
+  } // namespace detail
+
 /////////////////////////////////////////////////////////////////////////////
 // template class ExactPredicateLpSeparableMetric
 /**
@@ -68,12 +126,22 @@ namespace DGtal
    * \sum_{i=0}^{n-1} |x_i-y_i|^p\right)^{1/p}@f$
    *
    * This class is said to be exact in the sense that the power @a p
-   * is computed without approximation (exponentiation by squaring in
-   * @f$ O(log(p))@f$ per computation, see
-   * functions::power). As a consequence, @a hiddenBy and
-   * @a closest methods are error free if the capacity of the template
-   * type @a TPromoted allows to store sums of @f$ |x_i-y_i|^p@f$
-   * quantities.
+   * is computed without approximation (exponentiation by squaring
+   * unrolled at compile time, see detail::LpPower). As a consequence,
+   * @a hiddenBy and @a closest methods are error free if the capacity
+   * of the template type @a TRawValue allows to store sums of @f$
+   * |x_i-y_i|^p@f$ quantities.
+   *
+   * The boundary between two Voronoi cells along a line is computed
+   * in closed form for p=1 and p=2 (specialization), and by a binary
+   * search otherwise. See ExactPredicateLinfSeparableMetric for the
+   * @f$ l_\infty @f$ metric.
+   *
+   * Besides the point based methods, the class offers kernels working
+   * on the partial distances of the sites of a row (see
+   * partialRawDistances): VoronoiMap computes them once per row with
+   * a single loop, and then only handles abscissae and partial
+   * distances.
    *
    * @tparam TSpace the model of CSpace on which the metric is
    * defined.
@@ -104,6 +172,8 @@ namespace DGtal
     typedef typename Point::Coordinate Abscissa;
     ///Type for vectors
     typedef typename Space::Vector Vector;
+    ///Type for dimensions
+    typedef typename Space::Dimension Dimension;
 
     ///Type for internal distance values
     typedef TRawValue RawValue;
@@ -183,6 +253,53 @@ namespace DGtal
      */
     RawValue rawDistance(const Point & aP, const Point &aQ) const;
 
+    /**
+     * Compute the raw distance between @a aP and @a aQ, discarding
+     * the term along dimension @a dim (i.e. @f$ \sum_{i\neq dim}
+     * |x_i-y_i |^p\f$).
+     *
+     * @param aP a first point.
+     * @param aQ a second point.
+     * @param dim the discarded dimension.
+     *
+     * @return the partial raw distance between aP and aQ.
+     */
+    RawValue partialRawDistance(const Point & aP, const Point &aQ,
+                                const Dimension dim) const;
+
+    /**
+     * Compute the partial raw distances (see partialRawDistance) of
+     * the sites [itb,ite) to the row starting at @a startingPoint along
+     * dimension @a dim.
+     *
+     * @param itb pointer to the first site.
+     * @param ite pointer after the last site.
+     * @param startingPoint starting point of the row.
+     * @param dim direction of the row.
+     * @param out [out] the partial raw distances (as many as sites).
+     */
+    void partialRawDistances(const Point * itb, const Point * ite,
+                             const Point & startingPoint,
+                             const Dimension dim,
+                             RawValue * out) const;
+
+    /**
+     * Given a point at abscissa @a x on a row and two sites of partial
+     * raw distances @a nu and @a nv to the row, decides which one is
+     * closest to the point.
+     *
+     * @param x abscissa of the point.
+     * @param udim abscissa of the first site.
+     * @param nu partial raw distance of the first site.
+     * @param vdim abscissa of the second site.
+     * @param nv partial raw distance of the second site.
+     *
+     * @return a Closest enum: FIRST, SECOND or BOTH.
+     */
+    Closest closest(const Abscissa x,
+                    const Abscissa udim, const RawValue nu,
+                    const Abscissa vdim, const RawValue nv) const;
+
       // ----------------------- CSeparableMetric --------------------------------------
     /**
      * Given three sites (u,v,w) and a straight segment
@@ -212,6 +329,28 @@ namespace DGtal
                   const Point &endPoint,
                   const typename Point::UnsignedComponent dim) const;
 
+    /**
+     * Same as hiddenBy above, the sites being given by their abscissae
+     * and partial raw distances to the row [lower,upper].
+     *
+     * @pre udim < vdim < wdim
+     *
+     * @param udim abscissa of u
+     * @param nu partial raw distance of u
+     * @param vdim abscissa of v
+     * @param nv partial raw distance of v
+     * @param wdim abscissa of w
+     * @param nw partial raw distance of w
+     * @param lower abscissa of the starting point of the row
+     * @param upper abscissa of the end point of the row
+     *
+     * @return true if (u,w) hides v (strictly).
+     */
+    bool hiddenBy(const Abscissa udim, const RawValue nu,
+                  const Abscissa vdim, const RawValue nv,
+                  const Abscissa wdim, const RawValue nw,
+                  const Abscissa lower, const Abscissa upper) const;
+
 
     /**
      * Writes/Displays the object on an output stream.
@@ -252,6 +391,38 @@ namespace DGtal
                                 const Abscissa &lower,
                                 const Abscissa &upper) const;
 
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Returns the abscissa @a q of the interval [lower,upper] such
+     * that q belongs to the Voronoi cell of u (strictly) but not @a
+     * q+1, in closed form for p=1 and with binarySearchHidden otherwise.
+     *
+     * @pre udim < vdim and lower belongs to the cell of u (strictly).
+     *
+     * @param udim coordinate of u along dimension dim
+     * @param vdim coordinate of v along dimension dim
+     * @param nu partial raw distance of u
+     * @param nv partial raw distance of v
+     * @param lower interval lower bound
+     * @param upper interval upper bound
+     *
+     * @return the u Voronoi cell greatest point coordinates along dimension dim.
+     */
+    Abscissa bisector(const Abscissa udim,
+                      const Abscissa vdim,
+                      const RawValue nu,
+                      const RawValue nv,
+                      const Abscissa lower,
+                      const Abscissa upper) const;
+
+    /**
+     * @param x any abscissa.
+     * @return @f$ |x|^p @f$ as a RawValue.
+     */
+    static RawValue power(const Abscissa x);
+
   }; // end of class ExactPredicateLpSeparableMetric
 
 
@@ -276,6 +447,8 @@ namespace DGtal
     typedef typename Point::Coordinate Abscissa;
     ///Type for vectors
     typedef typename Space::Vector Vector;
+    ///Type for dimensions
+    typedef typename Space::Dimension Dimension;
 
     ///Type for internal distance values
     typedef TRawValue RawValue;
@@ -367,6 +540,51 @@ namespace DGtal
      */
     RawValue rawDistance(const Point &aP, const Point &aQ) const;
 
+    /**
+     * Compute the raw distance between @a aP and @a aQ, discarding
+     * the term along dimension @a dim.
+     *
+     * @param aP a first point.
+     * @param aQ a second point.
+     * @param dim the discarded dimension.
+     *
+     * @return the partial raw distance between aP and aQ.
+     */
+    RawValue partialRawDistance(const Point & aP, const Point &aQ,
+                                const Dimension dim) const;
+
+    /**
+     * Compute the partial raw distances of the sites [itb,ite) to the
+     * row starting at @a startingPoint along dimension @a dim.
+     *
+     * @param itb pointer to the first site.
+     * @param ite pointer after the last site.
+     * @param startingPoint starting point of the row.
+     * @param dim direction of the row.
+     * @param out [out] the partial raw distances (as many as sites).
+     */
+    void partialRawDistances(const Point * itb, const Point * ite,
+                             const Point & startingPoint,
+                             const Dimension dim,
+                             RawValue * out) const;
+
+    /**
+     * Given a point at abscissa @a x on a row and two sites of partial
+     * raw distances @a nu and @a nv to the row, decides which one is
+     * closest to the point.
+     *
+     * @param x abscissa of the point.
+     * @param udim abscissa of the first site.
+     * @param nu partial raw distance of the first site.
+     * @param vdim abscissa of the second site.
+     * @param nv partial raw distance of the second site.
+     *
+     * @return a Closest enum: FIRST, SECOND or BOTH.
+     */
+    Closest closest(const Abscissa x,
+                    const Abscissa udim, const RawValue nu,
+                    const Abscissa vdim, const RawValue nv) const;
+
     // ----------------------- CSeparableMetric --------------------------------------
     /**
      * Given three sites (a,b,c) and a straight segment
@@ -393,6 +611,27 @@ namespace DGtal
                   const Point &endPoint,
                   const typename Point::UnsignedComponent dim) const;
 
+    /**
+     * Same as hiddenBy above, the sites being given by their abscissae
+     * and partial raw distances to the row (closed form, the row
+     * bounds are not used).
+     *
+     * @param udim abscissa of u
+     * @param nu partial raw distance of u
+     * @param vdim abscissa of v
+     * @param nv partial raw distance of v
+     * @param wdim abscissa of w
+     * @param nw partial raw distance of w
+     * @param lower abscissa of the starting point of the row
+     * @param upper abscissa of the end point of the row
+     *
+     * @return true if (u,w) hides v.
+     */
+    bool hiddenBy(const Abscissa udim, const RawValue nu,
+                  const Abscissa vdim, const RawValue nv,
+                  const Abscissa wdim, const RawValue nw,
+                  const Abscissa lower, const Abscissa upper) const;
+
    // ----------------------- Other services --------------------------------------
     /**
      * Writes/Displays the object on an output stream.
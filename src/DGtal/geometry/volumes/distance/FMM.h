@@ -55,48 +55,13 @@
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/CPointFunctor.h"
 #include "DGtal/geometry/volumes/distance/FMMPointFunctors.h"
+#include "DGtal/geometry/volumes/distance/FMMCandidateQueues.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
-  namespace detail
-  {
-  /////////////////////////////////////////////////////////////////////////////
-  // template class PointValueCompare
-  /**
-   * Description of template class 'PointValueCompare' <p>
-   * \brief Aim: Small binary predicate to order candidates points 
-   * according to their (absolute) distance value. 
-   *
-   * @tparam T model of pair Point-Value
-   */
-    template<typename T>
-    class PointValueCompare {
-    public: 
-      /**
-       * Comparison function
-       *
-       * @param a an object of type T
-       * @param b another object of type T
-       *
-       * @return true if a < b but false otherwise
-       */
-      bool operator()(const T& a, const T& b) const
-      {
-	if ( std::abs(a.second) == std::abs(b.second) ) 
-	  { //point comparison
-	    return (a.first < b.first); 
-	  }
-	else //distance comparison
-	  //(in absolute value in order to deal with
-	  //signed distance values) 
-	  return ( std::abs(a.second) < std::abs(b.second) ); 
-      }
-    };
-  }
-
   /////////////////////////////////////////////////////////////////////////////
   // template class FMM
   /**
@@ -121,8 +86,11 @@ namespace DGtal
    * accepted points. The tentative values of the candidates adjacent 
    * to the newly added point are updated using the distance value
    * of the newly added point. The search of the point of smallest
-   * tentative value is accelerated using a STL set of pairs (point, 
-   * tentative value).  
+   * tentative value is accelerated using a priority queue of pairs
+   * (point, tentative value), by default a STL set
+   * (SetCandidateQueue). IndexedHeapCandidateQueue, a binary heap
+   * with decrease-key, is faster on large propagations but allocates
+   * a position map over the whole domain of the image.
    *
    * @tparam TImage  any model of CImage
    * @tparam TSet  any model of CDigitalSet
@@ -130,6 +98,9 @@ namespace DGtal
    * used to bound the computation within a domain 
    * @tparam TPointFunctor  any model of CPointFunctor,
    * used to compute the new distance value
+   * @tparam TCandidateQueue the priority queue of candidate points,
+   * SetCandidateQueue (default) or IndexedHeapCandidateQueue, on the
+   * domain of the image.
    *
    * You can define the FMM type as follows: 
    @snippet geometry/volumes/distance/exampleFMM3D.cpp FMMSimpleTypeDef3D
@@ -145,7 +116,9 @@ namespace DGtal
    * @see testFMM.cpp
    */
   template <typename TImage, typename TSet, typename TPointPredicate, 
-	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet>,
+	    typename TCandidateQueue = SetCandidateQueue<typename TImage::Domain,
+							 typename TPointFunctor::Value> >
   class FMM
   {
 
@@ -182,8 +155,8 @@ namespace DGtal
 
     //intern data types
     typedef std::pair<Point, Value> PointValue; 
-    typedef std::set<PointValue,
-		     detail::PointValueCompare<PointValue> > CandidatePointSet; 
+    typedef TCandidateQueue CandidatePointSet; 
+    BOOST_STATIC_ASSERT(( boost::is_same< PointValue, typename CandidatePointSet::PointValue >::value ));
     typedef unsigned long Area;
 
     // ------------------------- Private Datas --------------------------------
@@ -515,9 +488,10 @@ namespace DGtal
    * @param object the object of class 'FMM' to write.
    * @return the output stream after the writing.
    */
-  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor >
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor,
+	    typename TCandidateQueue >
   std::ostream&
-  operator<< ( std::ostream & out, const FMM<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+  operator<< ( std::ostream & out, const FMM<TImage, TSet, TPointPredicate, TPointFunctor, TCandidateQueue> & object );
 
 } // namespace DGtal
 
@@ -0,0 +1,293 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FMMCandidateQueues.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * @brief Priority queues of candidate points for the Fast Marching Method
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FMMCandidateQueues_RECURSES)
+#error Recursive header files inclusion detected in FMMCandidateQueues.h
+#else // defined(FMMCandidateQueues_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FMMCandidateQueues_RECURSES
+
+#if !defined FMMCandidateQueues_h
+/** Prevents repeated inclusion of headers. */
+#define FMMCandidateQueues_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstdlib>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointValueCompare
+  /**
+   * Description of template class 'PointValueCompare' <p>
+   * \brief Aim: Small binary predicate to order candidates points
+   * according to their (absolute) distance value.
+   *
+   * @tparam T model of pair Point-Value
+   */
+    template<typename T>
+    class PointValueCompare {
+    public:
+      /**
+       * Comparison function
+       *
+       * @param a an object of type T
+       * @param b another object of type T
+       *
+       * @return true if a < b but false otherwise
+       */
+      bool operator()(const T& a, const T& b) const
+      {
+	if ( std::abs(a.second) == std::abs(b.second) )
+	  { //point comparison
+	    return (a.first < b.first);
+	  }
+	else //distance comparison
+	  //(in absolute value in order to deal with
+	  //signed distance values)
+	  return ( std::abs(a.second) < std::abs(b.second) );
+      }
+    };
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SetCandidateQueue
+  /**
+   * Description of template class 'SetCandidateQueue' <p>
+   * \brief Aim: Queue of the candidate points of FMM, ordered by
+   * absolute distance value then by point, stored in a STL set of
+   * pairs (point, tentative value).
+   *
+   * Pushing a point already in the queue adds another pair, so that
+   * the queue may return points that are already accepted: FMM
+   * skips them.
+   *
+   * This is the default queue of FMM.
+   *
+   * @tparam TDomain the domain of the points (a HyperRectDomain).
+   * @tparam TValue the type of distance values.
+   *
+   * @see FMM, IndexedHeapCandidateQueue
+   */
+  template <typename TDomain, typename TValue>
+  class SetCandidateQueue
+  {
+  public:
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * UNUSED_PARAM aDomain the domain of the points.
+     */
+    SetCandidateQueue( const Domain & UNUSED(aDomain) ) {}
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// Removes all the candidates.
+    void clear();
+
+    /// @return 'true' iff there is no candidate.
+    bool empty() const;
+
+    /// @return the number of (point, value) pairs in the queue.
+    std::size_t size() const;
+
+    /**
+     * Inserts a candidate.
+     * @param aPoint the point.
+     * @param aValue its tentative distance value.
+     */
+    void push( const Point & aPoint, const Value & aValue );
+
+    /// @return the candidate of minimal absolute value.
+    const PointValue & top() const;
+
+    /// Removes the candidate of minimal absolute value.
+    void pop();
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The pairs (point, tentative value).
+    std::set<PointValue, detail::PointValueCompare<PointValue> > mySet;
+
+  }; // end of class SetCandidateQueue
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedHeapCandidateQueue
+  /**
+   * Description of template class 'IndexedHeapCandidateQueue' <p>
+   * \brief Aim: Queue of the candidate points of FMM, ordered as
+   * SetCandidateQueue, stored in a binary heap with a position map
+   * over the whole domain.
+   *
+   * A point is at most once in the heap: pushing a point already in
+   * the heap keeps its smallest (absolute) value and moves it up the
+   * heap (decrease-key). The heap lies in a single vector and the
+   * position map is a vector with one index per point of the domain,
+   * so that pushing and popping cost @f$ O(\log n)@f$ without any
+   * allocation, n being the number of candidates. FMM accepts the
+   * same points with the same values as with SetCandidateQueue.
+   *
+   * @note The position map allocates one DGtal::uint32_t per point of
+   * the whole domain, not per point of the narrow band: prefer
+   * SetCandidateQueue when FMM only computes a thin band in a large
+   * domain.
+   *
+   * @tparam TDomain the domain of the points (a HyperRectDomain).
+   * @tparam TValue the type of distance values.
+   *
+   * @see FMM, SetCandidateQueue
+   */
+  template <typename TDomain, typename TValue>
+  class IndexedHeapCandidateQueue
+  {
+  public:
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+    /// Type of the positions in the heap.
+    typedef DGtal::uint32_t Index;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Allocates the position map.
+     * @param aDomain the domain of the points.
+     * @throw InputException if the domain has more points than the
+     * greatest Index.
+     */
+    IndexedHeapCandidateQueue( const Domain & aDomain );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// Removes all the candidates.
+    void clear();
+
+    /// @return 'true' iff there is no candidate.
+    bool empty() const;
+
+    /// @return the number of candidates.
+    std::size_t size() const;
+
+    /**
+     * Inserts a candidate, or decreases its value if it is already in
+     * the queue with a greater absolute value.
+     * @param aPoint the point (in the domain).
+     * @param aValue its tentative distance value.
+     */
+    void push( const Point & aPoint, const Value & aValue );
+
+    /// @return the candidate of minimal absolute value.
+    const PointValue & top() const;
+
+    /// Removes the candidate of minimal absolute value.
+    void pop();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Position map value of the points which are not in the heap.
+    static const Index NotInHeap = static_cast<Index>( -1 );
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its index in the domain order.
+     */
+    std::size_t linearize( const Point & aPoint ) const;
+
+    /**
+     * Moves the pair at position @a i up the heap.
+     * @param i a position in the heap.
+     */
+    void siftUp( Index i );
+
+    /**
+     * Moves the pair at position @a i down the heap.
+     * @param i a position in the heap.
+     */
+    void siftDown( Index i );
+
+    /**
+     * Puts a pair at position @a i and updates the position map.
+     * @param i a position in the heap.
+     * @param aPair the pair.
+     */
+    void place( Index i, const PointValue & aPair );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The heap of pairs (point, tentative value).
+    std::vector<PointValue> myHeap;
+    /// The position in the heap of each point of the domain.
+    std::vector<Index> myPositions;
+    /// The lower bound of the domain.
+    Point myLowerBound;
+    /// The extent of the domain.
+    Point myExtent;
+    /// The comparison of pairs.
+    detail::PointValueCompare<PointValue> myCompare;
+
+  }; // end of class IndexedHeapCandidateQueue
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/FMMCandidateQueues.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FMMCandidateQueues_h
+
+#undef FMMCandidateQueues_RECURSES
+#endif // else defined(FMMCandidateQueues_RECURSES)
@@ -0,0 +1,326 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FastSweeping.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module FastSweeping.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FastSweeping_RECURSES)
+#error Recursive header files inclusion detected in FastSweeping.h
+#else // defined(FastSweeping_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FastSweeping_RECURSES
+
+#if !defined FastSweeping_h
+/** Prevents repeated inclusion of headers. */
+#define FastSweeping_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/CPointFunctor.h"
+#include "DGtal/geometry/volumes/distance/FMMPointFunctors.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FastSweeping
+  /**
+   * Description of template class 'FastSweeping' <p>
+   * \brief Aim: Fast sweeping method for nd distance transforms, an
+   * alternative to FMM whose sweeps are computed in parallel.
+   *
+   * As FMM, the algorithm computes a signed distance function from an
+   * initial set of points whose values are known (the seeds, which
+   * are never modified), with the same image and set of accepted
+   * points, and the same point functors (L2FirstOrderLocalDistance
+   * by default or L1LocalDistance) to compute the value of a point
+   * from the values of its neighbors. L2SecondOrderLocalDistance and
+   * LInfLocalDistance are not suited: they use every known neighbor,
+   * which is correct only when, as in FMM, the known neighbors are
+   * closer than the point. Instead of accepting the points by
+   * increasing distance, it sweeps the domain of the image in the
+   * @f$ 2^d @f$ diagonal directions (Gauss-Seidel iterations): each
+   * point of the point predicate with a neighbor of known value gets
+   * the value computed by the point functor if it is smaller (in
+   * absolute value) than its current value. Iterations of @f$ 2^d @f$
+   * sweeps are repeated until no value changes.
+   *
+   * A sweep in direction @f$ s \in \{-1,1\}^d @f$ processes the
+   * hyperplanes @f$ \sum_i s_i x_i = c @f$ by increasing @a c. The
+   * 1-neighbors of a point lie on the previous and the next
+   * hyperplanes, so that the values of a hyperplane are computed in
+   * parallel when WITH_OPENMP is defined, the results being the same
+   * as without OpenMP. The new values are then stored by one thread,
+   * so that the image and the set need not be thread-safe for
+   * writing, but they must be for concurrent reading. The point
+   * predicate is evaluated once per point, sequentially, before the
+   * sweeps: it need not be thread-safe.
+   *
+   * The number of iterations depends on the shape of the domain
+   * (typically two or three for a convex domain), and not on the
+   * distances, while FMM is sequential and sorts the points.
+   *
+   * @code
+   * typedef FastSweeping<Image, Set, Predicate> Sweeping;
+   * FMM<Image, Set, Predicate>::initFromPointsRange( seeds.begin(), seeds.end(), image, set, 0.0 );
+   * Sweeping sweeping( image, set, predicate );
+   * sweeping.compute();
+   * @endcode
+   *
+   * @tparam TImage  any model of CImage on a HyperRectDomain
+   * @tparam TSet  any model of CDigitalSet
+   * @tparam TPointPredicate  any model of concepts::CPointPredicate,
+   * used to bound the computation within the domain of the image
+   * @tparam TPointFunctor  any model of CPointFunctor,
+   * used to compute the new distance value from the upwind neighbors
+   *
+   * @see FMM, testFastSweeping.cpp
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate,
+            typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+  class FastSweeping
+  {
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    //concept assert
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImage> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet<TSet> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointFunctor<TPointFunctor> ));
+
+    typedef TImage Image;
+    typedef TSet AcceptedPointSet;
+    typedef TPointPredicate PointPredicate;
+    typedef typename Image::Domain Domain;
+
+    //points
+    typedef typename Image::Point Point;
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename AcceptedPointSet::Point >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename PointPredicate::Point >::value ));
+
+    //dimension
+    typedef typename Point::Dimension Dimension;
+
+    //distance
+    typedef TPointFunctor PointFunctor;
+    typedef typename PointFunctor::Value Value;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image, with the values of the seeds.
+     * @param aSet the set of accepted points, which are the seeds.
+     * @param aPointPredicate the predicate bounding the computation.
+     *
+     * @throw InputException if there is no seed.
+     */
+    FastSweeping( Image& aImg, AcceptedPointSet& aSet,
+                  const PointPredicate& aPointPredicate );
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image, with the values of the seeds.
+     * @param aSet the set of accepted points, which are the seeds.
+     * @param aPointPredicate the predicate bounding the computation.
+     * @param aValueThreshold the points of greater (absolute)
+     * distance value are not accepted.
+     * @param aPointFunctor the point functor (on @a aImg and @a aSet).
+     *
+     * @throw InputException if there is no seed.
+     */
+    FastSweeping( Image& aImg, AcceptedPointSet& aSet,
+                  const PointPredicate& aPointPredicate,
+                  const Value& aValueThreshold,
+                  PointFunctor& aPointFunctor );
+
+    /**
+     * Destructor.
+     */
+    ~FastSweeping();
+
+  private:
+
+    FastSweeping( const FastSweeping & other );
+
+    FastSweeping & operator=( const FastSweeping & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computes the signed distance function by iterating sweeps until
+     * no value changes.
+     *
+     * @see computeOneIteration
+     */
+    void compute();
+
+    /**
+     * Sweeps the domain in the @f$ 2^d @f$ diagonal directions.
+     *
+     * @return 'true' if a value changed, 'false' otherwise.
+     */
+    bool computeOneIteration();
+
+    /**
+     * @return the number of iterations done so far.
+     */
+    unsigned int nbIterations() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// State of a point of the domain (Outside: not a seed and
+    /// outside the point predicate).
+    enum State { Unknown = 0, Known = 1, Seed = 2, Outside = 3 };
+
+    /**
+     * Initializes the states of the points from the set of accepted
+     * points and from the point predicate, which is evaluated once
+     * per point, sequentially.
+     */
+    void init();
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its index in the domain order.
+     */
+    std::size_t linearize( const Point & aPoint ) const;
+
+    /**
+     * @param aState the state of a point.
+     * @return 'true' iff the point has a known value (Known or Seed).
+     */
+    static bool isKnown( unsigned char aState );
+
+    /**
+     * Sweeps the domain in one direction.
+     *
+     * @param aDirection the direction, bit k being set iff the
+     * coordinate k decreases.
+     * @return 'true' if a value changed, 'false' otherwise.
+     */
+    bool sweep( unsigned int aDirection );
+
+    /**
+     * Gives the points of a hyperplane of a sweep.
+     *
+     * @param aDirection the direction of the sweep.
+     * @param aLevel the index of the hyperplane.
+     * @param aPoints (returns) the points of the hyperplane.
+     */
+    void hyperplane( unsigned int aDirection, DGtal::int64_t aLevel,
+                     std::vector<Point> & aPoints ) const;
+
+    /**
+     * Computes the new value of a point if it must be updated.
+     *
+     * @param aPoint a point of the domain.
+     * @param aValue (returns) its new value.
+     * @return 'true' if the point must be updated, 'false' otherwise.
+     */
+    bool newValue( const Point & aPoint, Value & aValue ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Reference on the image
+    Image& myImage;
+    /// Reference on the set of accepted points
+    AcceptedPointSet& myAcceptedPoints;
+    /// Pointer on the point functor
+    PointFunctor* myPointFunctorPtr;
+    /// 'true' if @a myPointFunctorPtr is an owning pointer
+    const bool myFlagIsOwning;
+    /// Constant reference on the point predicate
+    const PointPredicate& myPointPredicate;
+    /// Value threshold above which points are not accepted
+    Value myValueThreshold;
+    /// Lower bound of the domain of the image
+    Point myLowerBound;
+    /// Upper bound of the domain of the image
+    Point myUpperBound;
+    /// The state of each point of the domain (see State)
+    std::vector<unsigned char> myStates;
+    /// Number of iterations done so far
+    unsigned int myNbIterations;
+
+  }; // end of class FastSweeping
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FastSweeping'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FastSweeping' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const FastSweeping<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/FastSweeping.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FastSweeping_h
+
+#undef FastSweeping_RECURSES
+#endif // else defined(FastSweeping_RECURSES)
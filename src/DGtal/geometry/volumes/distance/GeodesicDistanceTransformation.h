@@ -0,0 +1,282 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file GeodesicDistanceTransformation.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module GeodesicDistanceTransformation.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(GeodesicDistanceTransformation_RECURSES)
+#error Recursive header files inclusion detected in GeodesicDistanceTransformation.h
+#else // defined(GeodesicDistanceTransformation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define GeodesicDistanceTransformation_RECURSES
+
+#if !defined GeodesicDistanceTransformation_h
+/** Prevents repeated inclusion of headers. */
+#define GeodesicDistanceTransformation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class GeodesicDistanceTransformation
+  /**
+   * Description of template class 'GeodesicDistanceTransformation' <p>
+   * \brief Aim: Geodesic distance transformation inside a digital
+   * object, for a chamfer norm.
+   *
+   * Given a point predicate (e.g. a digital set) on a
+   * HyperRectDomain and some source points, the class computes for
+   * each point of the object the length of the shortest path from a
+   * source, made of steps of the chamfer mask between points of the
+   * object. The steps are the directions of the mask with all their
+   * symmetries, and the weight of a step v is the raw distance of
+   * the norm between 0 and v. Note that a step may cross points
+   * which are not in the object if the mask has vectors longer than
+   * the 3^d-1 neighborhood (e.g. the 5-7-11 mask).
+   *
+   * The weights are integers, so that the points are accepted by
+   * increasing distance with a bucket queue (Dial's algorithm): a
+   * circular array of @a W + 1 buckets, @a W being the largest
+   * weight, instead of a priority queue. The distances are stored in
+   * an array with one value per point of the domain. The computation
+   * is in @f$ O(m.n + D)@f$, for @a n points of the object, @a m
+   * mask vectors and a maximal distance @a D.
+   *
+   * This class is a model of CConstImage: at a point, it returns the
+   * (normalized) geodesic distance, or the largest value if the
+   * point is not reached.
+   *
+   * @code
+   * typedef experimental::ChamferNorm2D<Z2i::Space> Norm;
+   * GeodesicDistanceTransformation<Z2i::DigitalSet, Norm> geodesic( domain, set, norm );
+   * geodesic.compute( sources.begin(), sources.end() );
+   * @endcode
+   *
+   * @tparam TPointPredicate any model of concepts::CPointPredicate
+   * (e.g. a CDigitalSet) defining the object.
+   * @tparam TChamferNorm a chamfer norm with a @a rawDistance
+   * method and a range [begin(),end()) on its mask directions
+   * (e.g. experimental::ChamferNorm2D).
+   *
+   * @see ChamferNorm2D, testGeodesicDistanceTransformation.cpp
+   */
+  template <typename TPointPredicate, typename TChamferNorm>
+  class GeodesicDistanceTransformation
+  {
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+
+    typedef TPointPredicate PointPredicate;
+    typedef TChamferNorm ChamferNorm;
+    typedef typename ChamferNorm::Space Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Dimension Dimension;
+    typedef HyperRectDomain<Space> Domain;
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename PointPredicate::Point >::value ));
+
+    ///Type of the (integer) path lengths
+    typedef typename ChamferNorm::RawValue RawValue;
+    ///Type of the normalized distances
+    typedef typename ChamferNorm::Value Value;
+
+    ///Self type
+    typedef GeodesicDistanceTransformation<TPointPredicate, TChamferNorm> Self;
+
+    ///Definition of the image constRange
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. No point is reached until compute() is called.
+     *
+     * All parameters are aliased in this class.
+     *
+     * @param aDomain the domain of the computation.
+     * @param aPredicate the predicate defining the object.
+     * @param aNorm the chamfer norm.
+     */
+    GeodesicDistanceTransformation( ConstAlias<Domain> aDomain,
+                                    ConstAlias<PointPredicate> aPredicate,
+                                    ConstAlias<ChamferNorm> aNorm );
+
+    /**
+     * Destructor.
+     */
+    ~GeodesicDistanceTransformation();
+
+  private:
+
+    GeodesicDistanceTransformation( const GeodesicDistanceTransformation & other );
+
+    GeodesicDistanceTransformation & operator=( const GeodesicDistanceTransformation & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computes the geodesic distances from a range of sources. The
+     * sources which are outside the domain or the object are
+     * ignored.
+     *
+     * @param itBegin the first source.
+     * @param itEnd the end of the range of sources.
+     * @param aMaxDistance the points whose (raw) distance is greater
+     * are not reached (default: no bound).
+     *
+     * @tparam TPointIterator a model of forward iterator on points.
+     */
+    template <typename TPointIterator>
+    void compute( TPointIterator itBegin, TPointIterator itEnd,
+                  const RawValue & aMaxDistance = infinity() );
+
+    /**
+     * @return the value of the points which are not reached.
+     */
+    static RawValue infinity();
+
+    /**
+     * @return the domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a const range on the normalized distances.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the length of the shortest path from a source to this
+     * point, or infinity() if it is not reached.
+     */
+    RawValue rawDistance( const Point & aPoint ) const;
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the normalized geodesic distance of the point, as the
+     * norm normalizes its raw distances, or the largest Value if it
+     * is not reached.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * @return the steps of the paths.
+     */
+    const std::vector<Vector> & steps() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its index in the domain order.
+     */
+    std::size_t linearize( const Point & aPoint ) const;
+
+    /// Value of the points which are not tested against the predicate.
+    static RawValue unknown();
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Pointer to the domain
+    const Domain * myDomainPtr;
+    ///Pointer to the predicate defining the object
+    const PointPredicate * myPredicatePtr;
+    ///Pointer to the chamfer norm
+    const ChamferNorm * myNormPtr;
+    ///The steps of the paths
+    std::vector<Vector> mySteps;
+    ///The weights of the steps
+    std::vector<RawValue> myWeights;
+    ///The largest weight
+    RawValue myMaxWeight;
+    ///The normalized distance of a unit raw distance
+    Value myUnit;
+    ///Offsets between consecutive points along each dimension
+    std::vector<std::size_t> myStrides;
+    ///The distance of each point of the domain
+    std::vector<RawValue> myDistances;
+
+  }; // end of class GeodesicDistanceTransformation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'GeodesicDistanceTransformation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'GeodesicDistanceTransformation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPointPredicate, typename TChamferNorm>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const GeodesicDistanceTransformation<TPointPredicate, TChamferNorm> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/GeodesicDistanceTransformation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined GeodesicDistanceTransformation_h
+
+#undef GeodesicDistanceTransformation_RECURSES
+#endif // else defined(GeodesicDistanceTransformation_RECURSES)
@@ -0,0 +1,390 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OutOfCoreVoronoiMap.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module OutOfCoreVoronoiMap.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(OutOfCoreVoronoiMap_RECURSES)
+#error Recursive header files inclusion detected in OutOfCoreVoronoiMap.h
+#else // defined(OutOfCoreVoronoiMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OutOfCoreVoronoiMap_RECURSES
+
+#if !defined OutOfCoreVoronoiMap_h
+/** Prevents repeated inclusion of headers. */
+#define OutOfCoreVoronoiMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <cstdio>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OutOfCoreVoronoiMap
+  /**
+   * Description of template class 'OutOfCoreVoronoiMap' <p>
+   * \brief Aim: Out-of-core variant of VoronoiMap (and
+   * DistanceTransformation) for domains whose Voronoi map does not
+   * fit in memory.
+   *
+   * The Voronoi map is stored in a file as compact sites: the index of
+   * the closest site in the domain order, as an unsigned integer of
+   * type TSite, instead of a Point (4 or 8 bytes per point instead of
+   * d*4 bytes). The separable passes are computed by slabs, since each
+   * 1D problem is independent:
+   * - the passes along dimensions 0 to d-2 on slabs of hyperplanes
+   *   orthogonal to dimension d-1 (contiguous in the file);
+   * - the pass along dimension d-1 on slabs orthogonal to dimension
+   *   d-2 (read by contiguous chunks).
+   *
+   * Only one slab is in memory at a time, so that, e.g., the
+   * Euclidean Voronoi map of a 2048^3 volume is computed with 16
+   * planes slabs in about 1GB of memory (plus 64GB of disk with 64
+   * bits sites). Within a slab, the 1D problems are solved in
+   * parallel when WITH_OPENMP is set. The point predicate is only
+   * evaluated sequentially, while the sites of a slab are
+   * initialized, hence it may be backed by an image that is not
+   * thread-safe for reading, like TiledImage or ImageCache.
+   *
+   * The Voronoi map (resp. the distance transformation) is then
+   * delivered slab by slab to a consumer by process (resp.
+   * processDistances), or probed point by point with operator() (resp.
+   * distance), which reads the file.
+   *
+   * The result is the same as the one of VoronoiMap with the same
+   * metric.
+   *
+   * @code
+   * struct MaxDistance {
+   *   double value;
+   *   template <typename TImage>
+   *   void operator()( const TImage & slab )
+   *   { ... value = max( value, slab( p ) ) for all p of slab.domain() ... }
+   * };
+   * OutOfCoreVoronoiMap<Z3i::Space, Predicate, Z3i::L2Metric> vmap
+   *   ( domain, predicate, Z3i::l2Metric, "vmap.tmp", 16 );
+   * MaxDistance maxDistance;
+   * vmap.processDistances( maxDistance );
+   * @endcode
+   *
+   * @tparam TSpace type of Digital Space (model of CSpace), of dimension at least 2.
+   * @tparam TPointPredicate point predicate returning false for the
+   * sites (model of concepts::CPointPredicate).
+   * @tparam TSeparableMetric a model of CSeparableMetric.
+   * @tparam TSite the unsigned integer type of the compact sites,
+   * which must be able to hold the size of the domain (checked by
+   * the constructor).
+   *
+   * @see VoronoiMap, testOutOfCoreVoronoiMap.cpp
+   */
+  template < typename TSpace,
+             typename TPointPredicate,
+             typename TSeparableMetric,
+             typename TSite = DGtal::uint64_t >
+  class OutOfCoreVoronoiMap
+  {
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<TSeparableMetric> ));
+    BOOST_STATIC_ASSERT(( TSpace::dimension >= 2 ));
+
+    typedef OutOfCoreVoronoiMap<TSpace, TPointPredicate, TSeparableMetric, TSite> Self;
+    typedef TSpace Space;
+    typedef TPointPredicate PointPredicate;
+    typedef TSeparableMetric SeparableMetric;
+    typedef TSite Site;
+    typedef HyperRectDomain<Space> Domain;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Size Size;
+    ///Definition of the Voronoi map value type.
+    typedef Vector Value;
+    ///Definition of the distance type.
+    typedef typename SeparableMetric::Value Distance;
+    ///Type of the Voronoi map slabs.
+    typedef ImageContainerBySTLVector<Domain, Vector> VoronoiSlab;
+    ///Type of the distance transformation slabs.
+    typedef ImageContainerBySTLVector<Domain, Distance> DistanceSlab;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Computes the Voronoi map in the file @a aFilename.
+     *
+     * @param aDomain the (hyper-rectangular) domain.
+     * @param aPredicate the point predicate (the sites are the false points).
+     * @param aMetric the separable metric.
+     * @param aFilename the file storing the Voronoi map, created (or
+     * overwritten) and deleted by the destructor.
+     * @param aSlabSize the number of hyperplanes of the slabs.
+     *
+     * @throw IOException if the file cannot be created or written.
+     * @throw InputException if the number of points of the domain is
+     * not lower than the greatest value of TSite.
+     */
+    OutOfCoreVoronoiMap( ConstAlias<Domain> aDomain,
+                         ConstAlias<PointPredicate> aPredicate,
+                         ConstAlias<SeparableMetric> aMetric,
+                         const std::string & aFilename,
+                         Size aSlabSize ) throw( DGtal::IOException, DGtal::InputException );
+
+    /**
+     * Destructor. Deletes the file.
+     */
+    ~OutOfCoreVoronoiMap();
+
+  private:
+
+    OutOfCoreVoronoiMap( const OutOfCoreVoronoiMap & other );
+
+    OutOfCoreVoronoiMap & operator=( const OutOfCoreVoronoiMap & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the domain of the map.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a pointer to the metric.
+     */
+    const SeparableMetric* metric() const;
+
+    /**
+     * @return the number of slabs delivered by process.
+     */
+    Size nbSlabs() const;
+
+    /**
+     * @param i the index of a slab.
+     * @return its domain: hyperplanes orthogonal to dimension d-1.
+     */
+    Domain slabDomain( Size i ) const;
+
+    /**
+     * Reads the closest site to a point in the file. Not thread-safe.
+     *
+     * @param aPoint any point of the domain.
+     * @return the closest site, or a point outside the domain if the
+     * predicate is true everywhere.
+     *
+     * @throw IOException in case of read error.
+     */
+    Value operator()( const Point & aPoint ) const throw( DGtal::IOException );
+
+    /**
+     * Reads the distance of a point to the closest site. Not thread-safe.
+     *
+     * @param aPoint any point of the domain.
+     * @return its distance.
+     *
+     * @throw IOException in case of read error.
+     */
+    Distance distance( const Point & aPoint ) const throw( DGtal::IOException );
+
+    /**
+     * Calls aConsumer( slab ) for each slab of the Voronoi map, in
+     * order. The slabs are images of type VoronoiSlab on slabDomain( i ).
+     *
+     * @tparam TConsumer the type of the consumer.
+     * @param aConsumer the consumer.
+     *
+     * @throw IOException in case of read error.
+     */
+    template <typename TConsumer>
+    void process( TConsumer & aConsumer ) const throw( DGtal::IOException );
+
+    /**
+     * Calls aConsumer( slab ) for each slab of the distance
+     * transformation, in order. The slabs are images of type
+     * DistanceSlab on slabDomain( i ).
+     *
+     * @tparam TConsumer the type of the consumer.
+     * @param aConsumer the consumer.
+     *
+     * @throw IOException in case of read error.
+     */
+    template <typename TConsumer>
+    void processDistances( TConsumer & aConsumer ) const throw( DGtal::IOException );
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its compact site (its index in the domain order).
+     */
+    Site encode( const Point & aPoint ) const;
+
+    /**
+     * @param aSite a compact site.
+     * @return the corresponding point.
+     */
+    Point decode( Site aSite ) const;
+
+    /**
+     * @param aDomain any domain.
+     * @return its number of points, computed in 64 bits since
+     * Domain::size() wraps for domains of 2^32 points or more.
+     */
+    static DGtal::uint64_t nbPoints( const Domain & aDomain );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes the passes along dimensions 0 to d-2 on the slabs
+     * orthogonal to dimension d-1.
+     */
+    void computeFirstPasses() throw( DGtal::IOException );
+
+    /**
+     * Computes the pass along dimension d-1 on the slabs orthogonal
+     * to dimension d-2.
+     */
+    void computeLastPass() throw( DGtal::IOException );
+
+    /**
+     * Solves the 1D problems along @a dim of a block of compact sites.
+     *
+     * @param sites the compact sites of the block, in the order of @a block.
+     * @param block the domain of the block (whole along @a dim).
+     * @param dim the dimension.
+     */
+    void computeRows( std::vector<Site> & sites, const Domain & block,
+                      const Dimension dim ) const;
+
+    /**
+     * Given a voronoi map valid at dimension @a dim-1, updates a 1D
+     * row along dimension @a dim (see VoronoiMap).
+     *
+     * @param startingPoint the first point of the row.
+     * @param dim the dimension.
+     * @param row the sites of the row, updated in place.
+     * @param sites scratch buffer.
+     */
+    void computeOtherStep1D( const Point & startingPoint, const Dimension dim,
+                             std::vector<Point> & row,
+                             std::vector<Point> & sites ) const;
+
+    /**
+     * Reads or writes a block of compact sites in the file.
+     *
+     * @param position the index of the first site.
+     * @param count the number of sites.
+     * @param data the sites.
+     * @param write 'true' to write, 'false' to read.
+     *
+     * @throw IOException in case of error.
+     */
+    void transfer( DGtal::uint64_t position, size_t count, Site * data, bool write ) const
+      throw( DGtal::IOException );
+
+    /**
+     * Reads the compact sites of a slab and decodes them.
+     *
+     * @param i the index of the slab.
+     * @param slab (returns) its Voronoi map.
+     */
+    void readSlab( Size i, VoronoiSlab & slab ) const throw( DGtal::IOException );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Pointer to the domain.
+    const Domain * myDomainPtr;
+    /// Pointer to the point predicate.
+    const PointPredicate * myPointPredicatePtr;
+    /// Pointer to the separable metric.
+    const SeparableMetric * myMetricPtr;
+    /// The file name.
+    std::string myFilename;
+    /// The file.
+    FILE * myFile;
+    /// The number of hyperplanes of the slabs.
+    Size mySlabSize;
+    /// Extent of the domain.
+    Vector myExtent;
+    /// Compact site of the points without site.
+    Site myInfinitySite;
+    /// Point outside the domain, for the points without site.
+    Point myInfinity;
+
+  }; // end of class OutOfCoreVoronoiMap
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OutOfCoreVoronoiMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OutOfCoreVoronoiMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename P, typename Sep, typename TS>
+  std::ostream&
+  operator<< ( std::ostream & out, const OutOfCoreVoronoiMap<S,P,Sep,TS> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/OutOfCoreVoronoiMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OutOfCoreVoronoiMap_h
+
+#undef OutOfCoreVoronoiMap_RECURSES
+#endif // else defined(OutOfCoreVoronoiMap_RECURSES)
@@ -44,6 +44,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <utility>
 #include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
@@ -103,7 +104,14 @@ namespace DGtal
      * Extract reduced medial axis from a power map.
      * This methods is in @f$ O(|powerMap|)@f$. 
      *
-     * @param aPowerMap the input powerMap
+     * The rows of the power map along the first dimension are scanned
+     * in parallel when WITH_OPENMP is defined. Each thread collects
+     * the maximal balls of its rows, a site being collected once per
+     * row, and the balls are stored in the image container
+     * afterwards, so that it need not be thread-safe.
+     *
+     * @param aPowerMap the input powerMap (e.g. a PowerMap or a
+     * CompactPowerMap)
      * 
      * @return a lightweight proxy to the ImageContainer specified in
      * template arguments.
@@ -111,21 +119,64 @@ namespace DGtal
     static 
     Type getReducedMedialAxisFromPowerMap(const TPowerMap &aPowerMap) 
     {
-      typename TPowerMap::Value v;
-      TImageContainer *computedMA = new TImageContainer( aPowerMap.domain() );
-      for (typename TPowerMap::Domain::ConstIterator it = aPowerMap.domain().begin(), 
-             itend = aPowerMap.domain().end(); it != itend; ++it)
-        {
-          v =  aPowerMap(*it);
-          if  (aPowerMap.metricPtr()->powerDistance(*it, 
-                                                    v,
-                                                    aPowerMap.weightImagePtr()->operator()( v )) 
-               < NumberTraits<typename TPowerMap::PowerSeparableMetric::Value>::ZERO )
-            
-            computedMA->setValue( v,
-                                  aPowerMap.weightImagePtr()->operator()( v ));
-
-        }
+      typedef typename TPowerMap::Domain Domain;
+      typedef typename TPowerMap::Point Point;
+      typedef typename TPowerMap::Weight Weight;
+      typedef std::pair<Point, Weight> Ball;
+
+      const Domain & domain = aPowerMap.domain();
+      TImageContainer *computedMA = new TImageContainer( domain );
+      if ( domain.isEmpty() )
+        return Type( computedMA );
+
+      //Starting points of the rows along the first dimension
+      const Point infinity = domain.upperBound() + Point::diagonal(1);
+      Point upperRow = domain.upperBound();
+      upperRow[ 0 ] = domain.lowerBound()[ 0 ];
+      const Domain rowDomain( domain.lowerBound(), upperRow );
+      std::vector<Point> rowStarts;
+      rowStarts.reserve( rowDomain.size() );
+      for (typename Domain::ConstIterator it = rowDomain.begin(), 
+             itend = rowDomain.end(); it != itend; ++it)
+        rowStarts.push_back( *it );
+
+      std::vector<Ball> balls;
+      const int nbRows = (int) rowStarts.size();
+#ifdef WITH_OPENMP
+#pragma omp parallel
+#endif
+      {
+        std::vector<Ball> localBalls;
+#ifdef WITH_OPENMP
+#pragma omp for schedule(dynamic) nowait
+#endif
+        for ( int i = 0; i < nbRows; ++i )
+          {
+            Point p = rowStarts[ i ];
+            Point last = infinity;
+            for ( ; p[ 0 ] <= domain.upperBound()[ 0 ]; ++p[ 0 ] )
+              {
+                const Point v = aPowerMap( p );
+                if ( ( v == infinity ) || ( v == last ) )
+                  continue;
+                const Weight w = aPowerMap.weightImagePtr()->operator()( v );
+                if ( aPowerMap.metricPtr()->powerDistance( p, v, w )
+                     < NumberTraits<typename TPowerMap::PowerSeparableMetric::Value>::ZERO )
+                  {
+                    localBalls.push_back( Ball( v, w ) );
+                    last = v;
+                  }
+              }
+          }
+#ifdef WITH_OPENMP
+#pragma omp critical
+#endif
+        balls.insert( balls.end(), localBalls.begin(), localBalls.end() );
+      }
+
+      for ( typename std::vector<Ball>::const_iterator it = balls.begin(),
+              itend = balls.end(); it != itend; ++it )
+        computedMA->setValue( it->first, it->second );
       return Type( computedMA );
     }
   }; // end of class ReducedMedialAxis
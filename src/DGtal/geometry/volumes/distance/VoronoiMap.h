@@ -51,6 +51,8 @@
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLinfSeparableMetric.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/base/ConstAlias.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -91,6 +93,17 @@ namespace DGtal
    * in an optimal way: on @a p processors, expected runtime is in
    * @f$ O(h.d.n^d / p)@f$.
    *
+   * The rows along dimension @a d > 0 are processed by bundles of
+   * adjacent rows along dimension 0, copied in per-thread buffers, so
+   * that the strided passes access the image by contiguous blocks
+   * (directly in the storage when the image is an
+   * ImageContainerBySTLVector). The sites are initialized
+   * sequentially before the first pass, so that the point predicate
+   * is never called concurrently and need not be thread-safe. With ExactPredicateLpSeparableMetric
+   * and ExactPredicateLinfSeparableMetric, the partial distances of
+   * the sites of a row are computed once for the whole row, and the
+   * 1D step only handles abscissae and partial distances.
+   *
    * This class is a model of CConstImage.
    *
    * @tparam TSpace type of Digital Space (model of CSpace).
@@ -146,6 +159,9 @@ namespace DGtal
     ///Definition of the separable metric type
     typedef TSeparableMetric SeparableMetric;
 
+    ///Type of the raw distances of the metric
+    typedef typename SeparableMetric::RawValue RawValue;
+
     ///Large integer type for SeparableMetricHelper construction.
     typedef DGtal::int64_t IntegerLong;
 
@@ -262,6 +278,24 @@ namespace DGtal
      */
     void compute ( ) ;
 
+    /** 
+     * Initializes the sites of an image from the point predicate,
+     * sequentially.
+     * 
+     * @param [in] image the image.
+     */
+    template <typename TOtherImage>
+    void initSites(TOtherImage &image) const;
+
+    /** 
+     * Initializes the sites of an ImageContainerBySTLVector from the
+     * point predicate, sequentially and directly in its storage.
+     * 
+     * @param [in] image the image.
+     */
+    template <typename TDomain, typename TValue>
+    void initSites(ImageContainerBySTLVector<TDomain,TValue> &image) const;
+
 
     /** 
      *  Compute the other steps of the separable Voronoi map.
@@ -269,6 +303,85 @@ namespace DGtal
      * @param [in] dim the dimension to process
      */    
     void computeOtherSteps(const Dimension dim) const;
+
+    /** 
+     * Updates a bundle of @a width adjacent rows (along dimension 0)
+     * along the dimension @a dim. The rows are copied in @a rows,
+     * processed and copied back into the image.
+     * 
+     * @param [in] start starting point of the first row.
+     * @param [in] width number of rows.
+     * @param [in] dim dimension of the update.
+     * @param rows scratch buffer for the rows.
+     * @param sites scratch buffer for the sites of a row.
+     * @param partials scratch buffer for the partial distances of the sites.
+     */
+    void computeBundle(const Point &start,
+                       const Size width,
+                       const Dimension dim,
+                       std::vector<Value> &rows,
+                       std::vector<Point> &sites,
+                       std::vector<RawValue> &partials) const;
+
+    /** 
+     * Copies a bundle of rows of an image into @a rows (row after
+     * row).
+     * 
+     * @param [in] image the image.
+     * @param [in] start starting point of the first row.
+     * @param [in] width number of rows.
+     * @param [in] dim dimension of the rows.
+     * @param [out] rows the values (its size must be set).
+     */
+    template <typename TOtherImage>
+    void getBundle(const TOtherImage &image,
+                   const Point &start, const Size width, const Dimension dim,
+                   std::vector<Value> &rows) const;
+
+    /** 
+     * Copies a bundle of rows of an ImageContainerBySTLVector into @a
+     * rows, directly from its storage.
+     * 
+     * @param [in] image the image.
+     * @param [in] start starting point of the first row.
+     * @param [in] width number of rows.
+     * @param [in] dim dimension of the rows.
+     * @param [out] rows the values (its size must be set).
+     */
+    template <typename TDomain, typename TValue>
+    void getBundle(const ImageContainerBySTLVector<TDomain,TValue> &image,
+                   const Point &start, const Size width, const Dimension dim,
+                   std::vector<Value> &rows) const;
+
+    /** 
+     * Copies @a rows back into a bundle of rows of an image.
+     * 
+     * @param [in] image the image.
+     * @param [in] start starting point of the first row.
+     * @param [in] width number of rows.
+     * @param [in] dim dimension of the rows.
+     * @param [in] rows the values.
+     */
+    template <typename TOtherImage>
+    void setBundle(TOtherImage &image,
+                   const Point &start, const Size width, const Dimension dim,
+                   const std::vector<Value> &rows) const;
+
+    /** 
+     * Copies @a rows back into a bundle of rows of an
+     * ImageContainerBySTLVector, directly into its storage.
+     * 
+     * @param [in] image the image.
+     * @param [in] start starting point of the first row.
+     * @param [in] width number of rows.
+     * @param [in] dim dimension of the rows.
+     * @param [in] rows the values.
+     */
+    template <typename TDomain, typename TValue>
+    void setBundle(ImageContainerBySTLVector<TDomain,TValue> &image,
+                   const Point &start, const Size width, const Dimension dim,
+                   const std::vector<Value> &rows) const;
+
     /** 
      * Given  a voronoi map valid at dimension @a dim-1, this method
      * updates the map to make it consistent at dimension @a dim along
@@ -277,9 +390,92 @@ namespace DGtal
      * 
      * @param [in] row starting point of the 1D process.
      * @param [in] dim dimension of the update.
+     * @param values the values of the row, updated in place.
+     * @param sites scratch buffer for the sites of the row.
+     * @param partials scratch buffer for the partial distances of the sites.
      */
     void computeOtherStep1D (const Point &row, 
-			     const Size dim) const;
+			     const Size dim,
+			     Value *values,
+			     std::vector<Point> &sites,
+			     std::vector<RawValue> &partials) const;
+
+    /** 
+     * 1D step for any separable metric, with its point based
+     * hiddenBy and closest predicates.
+     * 
+     * @param [in] metric the metric.
+     * @param [in] row starting point of the 1D process.
+     * @param [in] dim dimension of the update.
+     * @param values the values of the row, updated in place.
+     * @param sites scratch buffer for the sites of the row.
+     * @param partials unused.
+     */
+    template <typename TMetric>
+    void computeOtherStep1D (const TMetric &metric,
+                             const Point &row, 
+			     const Size dim,
+			     Value *values,
+			     std::vector<Point> &sites,
+			     std::vector<RawValue> &partials) const;
+
+    /** 
+     * 1D step for ExactPredicateLpSeparableMetric (see computeRowStep1D).
+     * 
+     * @param [in] metric the metric.
+     * @param [in] row starting point of the 1D process.
+     * @param [in] dim dimension of the update.
+     * @param values the values of the row, updated in place.
+     * @param sites scratch buffer for the sites of the row.
+     * @param partials scratch buffer for the partial distances of the sites.
+     */
+    template <typename TOtherSpace, DGtal::uint32_t p, typename TRawValue>
+    void computeOtherStep1D (const ExactPredicateLpSeparableMetric<TOtherSpace,p,TRawValue> &metric,
+                             const Point &row, 
+			     const Size dim,
+			     Value *values,
+			     std::vector<Point> &sites,
+			     std::vector<RawValue> &partials) const;
+
+    /** 
+     * 1D step for ExactPredicateLinfSeparableMetric (see computeRowStep1D).
+     * 
+     * @param [in] metric the metric.
+     * @param [in] row starting point of the 1D process.
+     * @param [in] dim dimension of the update.
+     * @param values the values of the row, updated in place.
+     * @param sites scratch buffer for the sites of the row.
+     * @param partials scratch buffer for the partial distances of the sites.
+     */
+    template <typename TOtherSpace, typename TRawValue>
+    void computeOtherStep1D (const ExactPredicateLinfSeparableMetric<TOtherSpace,TRawValue> &metric,
+                             const Point &row, 
+			     const Size dim,
+			     Value *values,
+			     std::vector<Point> &sites,
+			     std::vector<RawValue> &partials) const;
+
+    /** 
+     * 1D step for the metrics with row kernels: the partial distances
+     * of all the sites of the row are computed at once with
+     * partialRawDistances, then the sites are pruned and the row
+     * rewritten with the hiddenBy and closest kernels working on
+     * abscissae and partial distances.
+     * 
+     * @param [in] metric the metric.
+     * @param [in] row starting point of the 1D process.
+     * @param [in] dim dimension of the update.
+     * @param values the values of the row, updated in place.
+     * @param sites scratch buffer for the sites of the row.
+     * @param partials scratch buffer for the partial distances of the sites.
+     */
+    template <typename TMetric>
+    void computeRowStep1D (const TMetric &metric,
+                           const Point &row, 
+                           const Size dim,
+                           Value *values,
+                           std::vector<Point> &sites,
+                           std::vector<RawValue> &partials) const;
     
     // ------------------- protected methods ------------------------
   protected:
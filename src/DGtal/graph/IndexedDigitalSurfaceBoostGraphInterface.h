@@ -0,0 +1,304 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IndexedDigitalSurfaceBoostGraphInterface.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module IndexedDigitalSurfaceBoostGraphInterface
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IndexedDigitalSurfaceBoostGraphInterface_RECURSES)
+#error Recursive header files inclusion detected in IndexedDigitalSurfaceBoostGraphInterface.h
+#else // defined(IndexedDigitalSurfaceBoostGraphInterface_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IndexedDigitalSurfaceBoostGraphInterface_RECURSES
+
+#if !defined IndexedDigitalSurfaceBoostGraphInterface_h
+/** Prevents repeated inclusion of headers. */
+#define IndexedDigitalSurfaceBoostGraphInterface_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/property_map/property_map.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+//////////////////////////////////////////////////////////////////////////////
+
+
+// The interface to the Boost Graph should be defined in namespace boost.
+namespace boost
+{
+
+  /**
+     Defines the boost graph traits for an indexed digital surface
+     (see DGtal::IndexedDigitalSurface). With these definitions, a
+     DGtal::IndexedDigitalSurface is a model of
+     VertexListGraphConcept, AdjacencyGraphConcept,
+     IncidenceGraphConcept, EdgeListGraphConcept.
+
+     Contrary to the interface of DGtal::DigitalSurface (see
+     DigitalSurfaceBoostGraphInterface.h), no intermediate container
+     is needed: vertices and arcs are integers, adjacent vertices are
+     read directly in the arrays of the indexed surface and out edges
+     of a vertex are a contiguous range of arcs. All iterators are
+     thus plain random access iterators. Vertex indices are the
+     vertices themselves (see \ref get( vertex_index_t, const DGtal::IndexedDigitalSurface<TDigitalSurfaceContainer> & )).
+
+     @tparam TDigitalSurfaceContainer the container chosen for the
+     digital surface that was indexed.
+  */
+  template < class TDigitalSurfaceContainer >
+  struct graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >
+  {
+    /// the adapted DGtal graph class.
+    typedef DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > Adapted;
+    /// the graph is undirected.
+    typedef undirected_tag directed_category;
+    /// the graph satisfies AdjacencyListGraph and VertexListGraph concepts.
+    typedef DigitalSurface_graph_traversal_category traversal_category;
+    /// the graph does not allow parallel edges.
+    typedef disallow_parallel_edge_tag edge_parallel_category;
+
+    /// the type for counting vertices
+    typedef typename Adapted::Size vertices_size_type;
+    /// the type for counting edges
+    typedef typename Adapted::Size edges_size_type;
+    /// the type for counting out or in edges
+    typedef typename Adapted::Size degree_size_type;
+
+    /// Vertex type
+    typedef typename Adapted::Vertex Vertex;
+    /// Vertex type
+    typedef Vertex vertex_descriptor;
+    /// (oriented) edge type
+    typedef typename Adapted::Arc Arc;
+    /// (oriented) edge type
+    typedef Arc edge_descriptor;
+    /// Iterator for visiting vertices.
+    typedef typename Adapted::ConstIterator vertex_iterator;
+    /// Iterator for visiting adjacent vertices.
+    typedef typename Adapted::VertexConstIterator adjacency_iterator;
+    /// Iterator for visiting out edges.
+    typedef counting_iterator< Arc > out_edge_iterator;
+    /// Iterator for visiting all edges of the graph.
+    typedef counting_iterator< Arc > edge_iterator;
+
+    /**
+     *  @return the invalid vertex for that kind of graph (the greatest Vertex).
+     */
+    static
+    inline
+    vertex_descriptor null_vertex()
+    {
+      return (std::numeric_limits<vertex_descriptor>::max)();
+    }
+  }; // end struct graph_traits< >
+
+  /**
+     Vertex indices of an indexed digital surface are the vertices
+     themselves.
+
+     @tparam TDigitalSurfaceContainer the container chosen for the
+     digital surface that was indexed.
+  */
+  template < class TDigitalSurfaceContainer >
+  struct property_map< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer >, vertex_index_t >
+  {
+    typedef identity_property_map type;
+    typedef identity_property_map const_type;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Functions for the boost graph interface to IndexedDigitalSurface<TDigitalSurfaceContainer>.
+
+  /**
+     @param edge an arc (s,t) on \a digSurf.
+     @param digSurf a valid indexed digital surface.
+     @return the vertex s.
+  */
+  template < class TDigitalSurfaceContainer >
+  inline
+  typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::vertex_descriptor
+  source( typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::edge_descriptor edge,
+          const DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > & digSurf )
+  {
+    return digSurf.tail( edge );
+  }
+  /**
+     @param edge an arc (s,t) on \a digSurf.
+     @param digSurf a valid indexed digital surface.
+     @return the vertex t.
+  */
+  template < class TDigitalSurfaceContainer >
+  inline
+  typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::vertex_descriptor
+  target( typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::edge_descriptor edge,
+          const DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > & digSurf )
+  {
+    return digSurf.head( edge );
+  }
+
+  /**
+     @param digSurf a valid indexed digital surface.
+     @return a pair< vertex_iterator, vertex_iterator > that
+     represents a range to visit all the vertices of \a digSurf.
+  */
+  template < class TDigitalSurfaceContainer >
+  inline
+  std::pair<
+    typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::vertex_iterator,
+    typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::vertex_iterator
+    >
+  vertices( const DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > & digSurf )
+  {
+    return std::make_pair( digSurf.begin(), digSurf.end() );
+  }
+
+  /**
+     @param digSurf a valid indexed digital surface.
+     @return the number of vertices of \a digSurf.
+  */
+  template < class TDigitalSurfaceContainer >
+  inline
+  typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::vertices_size_type
+  num_vertices( const DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > & digSurf )
+  {
+    return digSurf.size();
+  }
+
+  /**
+     @param u a vertex belonging to \a digSurf.
+     @param digSurf a valid indexed digital surface.
+     @return a pair< adjacency_iterator, adjacency_iterator > that
+     represents a range to visit the adjacent vertices of vertex \a
+     u.
+  */
+  template < class TDigitalSurfaceContainer >
+  inline
+  std::pair<
+    typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::adjacency_iterator,
+    typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::adjacency_iterator
+    >
+  adjacent_vertices( typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::vertex_descriptor u,
+                     const DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > & digSurf )
+  {
+    return std::make_pair( digSurf.beginNeighbors( u ), digSurf.endNeighbors( u ) );
+  }
+
+  /**
+     @param u a vertex belonging to \a digSurf.
+     @param digSurf a valid indexed digital surface.
+
+     @return a pair< out_edge_iterator, out_edge_iterator > that
+     represents a range to visit the out edges of vertex \a u. Each
+     out edge is a tuple (u,t) of vertices, where t != u.
+  */
+  template < class TDigitalSurfaceContainer >
+  inline
+  std::pair<
+    typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::out_edge_iterator,
+    typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::out_edge_iterator
+    >
+  out_edges( typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::vertex_descriptor u,
+             const DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > & digSurf )
+  {
+    typedef typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >
+      ::out_edge_iterator Iterator;
+    return std::make_pair( Iterator( digSurf.beginArc( u ) ), Iterator( digSurf.endArc( u ) ) );
+  }
+
+  /**
+     @param u a vertex belonging to \a digSurf.
+     @param digSurf a valid indexed digital surface.
+
+     @return the number of out edges at vertex \a u. Each out edge is
+     a tuple (u,t) of vertices, where t != u.
+  */
+  template < class TDigitalSurfaceContainer >
+  inline
+  typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::degree_size_type
+  out_degree( typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::vertex_descriptor u,
+              const DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > & digSurf )
+  {
+    return digSurf.degree( u );
+  }
+
+  /**
+     @param digSurf a valid indexed digital surface.
+     @return a pair< edge_iterator, edge_iterator > that represents a
+     range to visit all the (oriented) edges of \a digSurf, i.e. all
+     its arcs.
+  */
+  template < class TDigitalSurfaceContainer >
+  inline
+  std::pair<
+    typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::edge_iterator,
+    typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::edge_iterator
+    >
+  edges( const DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > & digSurf )
+  {
+    typedef typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >
+      ::edge_iterator Iterator;
+    return std::make_pair( Iterator( 0 ), Iterator( digSurf.nbArcs() ) );
+  }
+
+  /**
+     @param digSurf a valid indexed digital surface.
+     @return the number of (oriented) edges of \a digSurf.
+  */
+  template < class TDigitalSurfaceContainer >
+  inline
+  typename graph_traits< DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > >::edges_size_type
+  num_edges( const DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > & digSurf )
+  {
+    return digSurf.nbArcs();
+  }
+
+  /**
+     @param digSurf a valid indexed digital surface.
+     @return the vertex index map of \a digSurf, i.e. the identity.
+  */
+  template < class TDigitalSurfaceContainer >
+  inline
+  identity_property_map
+  get( vertex_index_t, const DGtal::IndexedDigitalSurface< TDigitalSurfaceContainer > & /* digSurf */ )
+  {
+    return identity_property_map();
+  }
+
+} // namespace boost
+
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IndexedDigitalSurfaceBoostGraphInterface_h
+
+#undef IndexedDigitalSurfaceBoostGraphInterface_RECURSES
+#endif // else defined(IndexedDigitalSurfaceBoostGraphInterface_RECURSES)
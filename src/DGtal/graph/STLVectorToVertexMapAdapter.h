@@ -0,0 +1,109 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file STLVectorToVertexMapAdapter.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for template class STLVectorToVertexMapAdapter
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(STLVectorToVertexMapAdapter_RECURSES)
+#error Recursive header files inclusion detected in STLVectorToVertexMapAdapter.h
+#else // defined(STLVectorToVertexMapAdapter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define STLVectorToVertexMapAdapter_RECURSES
+
+#if !defined STLVectorToVertexMapAdapter_h
+/** Prevents repeated inclusion of headers. */
+#define STLVectorToVertexMapAdapter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class STLVectorToVertexMapAdapter
+  /**
+  Description of template class 'STLVectorToVertexMapAdapter' <p> \brief
+  Aim: This class adapts a STL vector to match with the CVertexMap
+  concept, for graphs whose vertices are the integers 0, 1, ..., n-1
+  (e.g. IndexedDigitalSurface). The value of vertex v is the v-th
+  element of the vector, which grows when needed.
+
+  @tparam TVector the type of the vector (e.g. std::vector<double>).
+  @tparam TVertex the type of the vertices (an unsigned integral type).
+
+  @see STLMapToVertexMapAdapter
+   */
+  template < typename TVector, typename TVertex = typename TVector::size_type >
+  class STLVectorToVertexMapAdapter :
+    public TVector
+  {
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef STLVectorToVertexMapAdapter<TVector,TVertex> Self;
+    typedef TVector Container;
+    typedef TVertex Vertex;
+    typedef typename Container::value_type Value;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    STLVectorToVertexMapAdapter() : Container() {}
+
+    /**
+       Constructor.
+       @param n the number of vertices.
+       @param val the initial value of the vertices.
+    */
+    STLVectorToVertexMapAdapter( const Vertex n, const Value & val = Value() )
+      : Container( n, val ) {}
+
+    void setValue( Vertex v, Value val )
+    {
+      if ( v >= this->size() ) this->resize( v + 1 );
+      (*this)[ v ] = val;
+    }
+
+    Value operator()( Vertex v ) const
+    {
+      ASSERT( v < this->size() );
+      return (*this)[ v ];
+    }
+
+  }; // end of class STLVectorToVertexMapAdapter
+
+} // namespace DGtal
+
+
+
+#endif // !defined STLVectorToVertexMapAdapter_h
+
+#undef STLVectorToVertexMapAdapter_RECURSES
+#endif // else defined(STLVectorToVertexMapAdapter_RECURSES)
@@ -52,6 +52,7 @@
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/geometry/curves/GridCurve.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLinfSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpPowerSeparableMetric.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -110,6 +111,7 @@ namespace DGtal
 
     typedef ExactPredicateLpSeparableMetric<Space,2> L2Metric;
     typedef ExactPredicateLpSeparableMetric<Space,1> L1Metric;
+    typedef ExactPredicateLinfSeparableMetric<Space> LinfMetric;
     typedef ExactPredicateLpPowerSeparableMetric<Space,2> L2PowerMetric;
     typedef ExactPredicateLpPowerSeparableMetric<Space,1> L1PowerMetric;
  
@@ -187,6 +189,7 @@ namespace DGtal
 
     typedef ExactPredicateLpSeparableMetric<Space,2> L2Metric;
     typedef ExactPredicateLpSeparableMetric<Space,1> L1Metric;
+    typedef ExactPredicateLinfSeparableMetric<Space> LinfMetric;
     typedef ExactPredicateLpPowerSeparableMetric<Space,2> L2PowerMetric;
     typedef ExactPredicateLpPowerSeparableMetric<Space,1> L1PowerMetric;
 
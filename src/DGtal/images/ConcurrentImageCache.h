@@ -0,0 +1,381 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConcurrentImageCache.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ConcurrentImageCache.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConcurrentImageCache_RECURSES)
+#error Recursive header files inclusion detected in ConcurrentImageCache.h
+#else // defined(ConcurrentImageCache_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConcurrentImageCache_RECURSES
+
+#if !defined ConcurrentImageCache_h
+/** Prevents repeated inclusion of headers. */
+#define ConcurrentImageCache_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <map>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/CImageFactory.h"
+#include "DGtal/images/CImageCacheWritePolicy.h"
+#include "DGtal/base/Alias.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// Template class ConcurrentImageCache
+/**
+ * Description of template class 'ConcurrentImageCache' <p>
+ * \brief Aim: implements an images cache that may be shared by
+ * several threads.
+ *
+ * Contrary to ImageCache, pages are identified by an integer key
+ * (given by the caller, e.g. the linearized tile coordinates of
+ * ConcurrentTiledImage) together with their domain, and the read
+ * policy is built in:
+ *
+ *  - pages are distributed among shards (key modulo the number of
+ *    shards), each shard having its own lock, so that threads working
+ *    on different pages seldom wait for each other;
+ *  - each shard replaces its pages with the CLOCK (second chance)
+ *    algorithm, which approximates LRU with a single reference bit
+ *    per page;
+ *  - pages may be pinned: a pinned page is never detached, so that a
+ *    thread may iterate over it without holding any lock. If every
+ *    page of a shard is pinned, the shard grows beyond its capacity.
+ *
+ * Calls to the image factory (requestImage, flushImage, detachImage)
+ * and to the write policy are serialized by a global lock, since
+ * factories (HDF5 in particular) are generally not reentrant.
+ *
+ * Without OpenMP (WITH_OPENMP not defined), locks are no-ops and the
+ * cache behaves as a sharded CLOCK cache for a single thread.
+ *
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory type (model of CImageFactory).
+ * @tparam TWritePolicy an image cache write policy class (model of CImageCacheWritePolicy).
+ *
+ * @see ConcurrentTiledImage, ImageCache
+ */
+template <typename TImageContainer, typename TImageFactory, typename TWritePolicy>
+class ConcurrentImageCache
+{
+
+    // ----------------------- Types ------------------------------
+
+public:
+    typedef ConcurrentImageCache<TImageContainer, TImageFactory, TWritePolicy> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImageCacheWritePolicy<TWritePolicy> ));
+
+    ///Types copied from the container
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename ImageContainer::Point Point;
+    typedef typename ImageContainer::Value Value;
+    typedef typename Domain::Size Size;
+
+    typedef TImageFactory ImageFactory;
+    typedef TWritePolicy WritePolicy;
+
+    /**
+     * A lock, implemented with an OpenMP lock when WITH_OPENMP is
+     * defined and doing nothing otherwise.
+     */
+    class Lock
+    {
+    public:
+      Lock()
+      {
+#ifdef WITH_OPENMP
+        omp_init_lock( &myLock );
+#endif
+      }
+      ~Lock()
+      {
+#ifdef WITH_OPENMP
+        omp_destroy_lock( &myLock );
+#endif
+      }
+      void set()
+      {
+#ifdef WITH_OPENMP
+        omp_set_lock( &myLock );
+#endif
+      }
+      void unset()
+      {
+#ifdef WITH_OPENMP
+        omp_unset_lock( &myLock );
+#endif
+      }
+    private:
+      Lock( const Lock & other );
+      Lock & operator=( const Lock & other );
+#ifdef WITH_OPENMP
+      omp_lock_t myLock;
+#endif
+    };
+
+    /// A cached page.
+    struct Page
+    {
+      /// The key of the page.
+      Size key;
+      /// The image of the page or NULL if the slot is free.
+      ImageContainer * image;
+      /// Number of pins on the page.
+      unsigned int pins;
+      /// CLOCK reference bit.
+      bool referenced;
+    };
+
+    /// A shard of the cache: its pages, its CLOCK hand and its lock.
+    struct Shard
+    {
+      Shard() : hand( 0 ), hits( 0 ), misses( 0 ) {}
+      std::vector<Page> slots;
+      std::map<Size, unsigned int> slotOfKey;
+      unsigned int hand;
+      unsigned int hits;
+      unsigned int misses;
+      Lock lock;
+    };
+
+    // ----------------------- Standard services ------------------------------
+
+public:
+
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory (see ImageFactoryFromImage or ImageFactoryFromHDF5).
+     * @param aWritePolicy alias on a write policy.
+     * @param aMaxPages the number of pages kept in memory (not counting pinned pages beyond it).
+     * @param aNbShards the number of shards (independent locks).
+     */
+    ConcurrentImageCache( Alias<ImageFactory> anImageFactory,
+                          Alias<WritePolicy> aWritePolicy,
+                          unsigned int aMaxPages,
+                          unsigned int aNbShards = 16 );
+
+    /**
+     * Destructor. Flushes and detaches all the pages.
+     */
+    ~ConcurrentImageCache();
+
+private:
+
+    ConcurrentImageCache( const ConcurrentImageCache & other );
+
+    ConcurrentImageCache & operator=( const ConcurrentImageCache & other );
+
+    // ----------------------- Interface --------------------------------------
+public:
+
+    /**
+     * Get the value at aPoint of the page aKey, loading the page
+     * (domain aDomain) if it is not in the cache.
+     *
+     * @param aKey the page key.
+     * @param aDomain the page domain.
+     * @param aPoint a point of aDomain.
+     * @return the value at aPoint.
+     */
+    Value read( Size aKey, const Domain & aDomain, const Point & aPoint );
+
+    /**
+     * Set the value at aPoint of the page aKey, loading the page
+     * (domain aDomain) if it is not in the cache. The value is
+     * written according to the write policy.
+     *
+     * @param aKey the page key.
+     * @param aDomain the page domain.
+     * @param aPoint a point of aDomain.
+     * @param aValue the new value.
+     */
+    void write( Size aKey, const Domain & aDomain, const Point & aPoint, const Value & aValue );
+
+    /**
+     * Pin the page aKey, loading it (domain aDomain) if it is not in
+     * the cache. The page stays in memory until a matching call to
+     * unpin.
+     *
+     * @param aKey the page key.
+     * @param aDomain the page domain.
+     * @return the image of the page.
+     */
+    ImageContainer * pin( Size aKey, const Domain & aDomain );
+
+    /**
+     * Unpin the page aKey.
+     * @pre the page has been pinned.
+     * @param aKey the page key.
+     */
+    void unpin( Size aKey );
+
+    /**
+     * Load the page aKey (domain aDomain) if it is not in the cache,
+     * without pinning it.
+     *
+     * @param aKey the page key.
+     * @param aDomain the page domain.
+     */
+    void prefetch( Size aKey, const Domain & aDomain );
+
+    /**
+     * Flush and detach all the pages and reset the statistics.
+     * @pre no page is pinned and no other thread uses the cache.
+     */
+    void clearCacheAndResetCacheMisses();
+
+    /**
+     * @return the number of page loads so far.
+     */
+    unsigned int getCacheMissRead() const;
+
+    /**
+     * @return the number of accesses to a page already in memory.
+     */
+    unsigned int getCacheHits() const;
+
+    /**
+     * @return the number of pages in memory.
+     */
+    unsigned int nbPages() const;
+
+    /**
+     * @return the number of shards.
+     */
+    unsigned int nbShards() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+private:
+
+    /// Alias on the image factory
+    ImageFactory * myImageFactoryPtr;
+
+    /// Alias on the write policy
+    WritePolicy * myWritePolicy;
+
+    /// Maximal number of unpinned pages per shard.
+    unsigned int myShardCapacity;
+
+    /// The shards.
+    std::vector<Shard*> myShards;
+
+    /// Lock serializing the calls to the factory and the write policy.
+    mutable Lock myFactoryLock;
+
+    // ------------------------- Internals ------------------------------------
+private:
+
+    /**
+     * @param aKey a page key.
+     * @return the shard of this page.
+     */
+    Shard & shard( Size aKey ) const;
+
+    /**
+     * Finds the page aKey in aShard, loading it if necessary.
+     * @pre the lock of aShard is set.
+     *
+     * @param aShard the shard of the page.
+     * @param aKey the page key.
+     * @param aDomain the page domain.
+     * @return the page.
+     */
+    Page & getPage( Shard & aShard, Size aKey, const Domain & aDomain );
+
+    /**
+     * Chooses the slot receiving a new page in aShard with the CLOCK
+     * algorithm, detaching its previous page if any.
+     * @pre the lock of aShard is set.
+     *
+     * @param aShard a shard.
+     * @return the index of the free slot.
+     */
+    unsigned int freeSlot( Shard & aShard );
+
+    /**
+     * Flushes (according to the write policy) and detaches a page.
+     * @param aPage a page with an image.
+     */
+    void detach( Page & aPage );
+
+}; // end of class ConcurrentImageCache
+
+
+/**
+ * Overloads 'operator<<' for displaying objects of class 'ConcurrentImageCache'.
+ * @param out the output stream where the object is written.
+ * @param object the object of class 'ConcurrentImageCache' to write.
+ * @return the output stream after the writing.
+ */
+template <typename TImageContainer, typename TImageFactory, typename TWritePolicy>
+std::ostream&
+operator<< ( std::ostream & out, const ConcurrentImageCache<TImageContainer, TImageFactory, TWritePolicy> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ConcurrentImageCache.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConcurrentImageCache_h
+
+#undef ConcurrentImageCache_RECURSES
+#endif // else defined(ConcurrentImageCache_RECURSES)
@@ -0,0 +1,358 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConcurrentTiledImage.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ConcurrentTiledImage.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConcurrentTiledImage_RECURSES)
+#error Recursive header files inclusion detected in ConcurrentTiledImage.h
+#else // defined(ConcurrentTiledImage_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConcurrentTiledImage_RECURSES
+
+#if !defined ConcurrentTiledImage_h
+/** Prevents repeated inclusion of headers. */
+#define ConcurrentTiledImage_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/CImageFactory.h"
+#include "DGtal/images/CImageCacheWritePolicy.h"
+#include "DGtal/base/Alias.h"
+
+#include "DGtal/images/ImageCachePolicies.h"
+#include "DGtal/images/ConcurrentImageCache.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class ConcurrentTiledImage
+  /**
+   * Description of template class 'ConcurrentTiledImage' <p>
+   * \brief Aim: implements a tiled image from a "bigger/original" one
+   * from an ImageFactory, that may be read and written by several
+   * threads at the same time.
+   *
+   * Tiles are kept in a ConcurrentImageCache (sharded, CLOCK
+   * replacement, pinned pages). Point accesses (operator(), setValue)
+   * lock only the shard of the tile. For tile-wise processing, a
+   * PinnedTile gives direct access to the tile image, which cannot be
+   * detached while the PinnedTile exists, and prefetchNeighbors loads
+   * the adjacent tiles ahead of time (as OpenMP tasks when WITH_OPENMP
+   * is defined, so that idle threads of the team do the loading).
+   *
+   * A typical OpenMP loop is then:
+   * @code
+   * Domain blocks = tiledImage.domainBlockCoords();
+   * std::vector<Point> coords( blocks.begin(), blocks.end() );
+   * #pragma omp parallel for schedule(dynamic)
+   * for ( int i = 0; i < (int) coords.size(); ++i )
+   *   {
+   *     MyTiledImage::PinnedTile tile = tiledImage.pinTile( coords[ i ] );
+   *     tiledImage.prefetchNeighbors( coords[ i ] );
+   *     for ( OutputImage::Domain::ConstIterator it = tile.image()->domain().begin(),
+   *             itE = tile.image()->domain().end(); it != itE; ++it )
+   *       ... (*tile.image())( *it ) ...
+   *   }
+   * @endcode
+   *
+   * Threads writing the same point at the same time, or writing a
+   * point of a pinned tile that another thread is reading, still
+   * race as with any image.
+   *
+   * @tparam TImageContainer an image container type (model of CImage).
+   * @tparam TImageFactory an image factory type (model of CImageFactory).
+   * @tparam TImageCacheWritePolicy an image cache write policy class (model of CImageCacheWritePolicy).
+   *
+   * @see TiledImage, ConcurrentImageCache
+   * @see testConcurrentTiledImage.cpp
+   */
+  template <typename TImageContainer, typename TImageFactory, typename TImageCacheWritePolicy>
+  class ConcurrentTiledImage
+  {
+
+    // ----------------------- Types ------------------------------
+
+  public:
+    typedef ConcurrentTiledImage<TImageContainer, TImageFactory, TImageCacheWritePolicy> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImageCacheWritePolicy<TImageCacheWritePolicy> ));
+
+    ///Types copied from the container
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename ImageContainer::Point Point;
+    typedef typename ImageContainer::Value Value;
+    typedef typename Domain::Size Size;
+
+    ///Types
+    typedef TImageFactory ImageFactory;
+    typedef typename ImageFactory::OutputImage OutputImage;
+
+    typedef TImageCacheWritePolicy ImageCacheWritePolicy;
+    typedef ConcurrentImageCache<OutputImage, ImageFactory, ImageCacheWritePolicy> MyImageCache;
+
+    /**
+     * A tile pinned in the cache: the tile image stays valid as long
+     * as this object (or a copy of it) exists.
+     */
+    class PinnedTile
+    {
+    public:
+      /**
+       * Constructor. Pins the tile.
+       * @param aTiledImage the tiled image.
+       * @param aCoord the block coords of the tile.
+       */
+      PinnedTile( const Self & aTiledImage, const Point & aCoord )
+        : myTiledImage( &aTiledImage ), myCoord( aCoord )
+      {
+        myImage = myTiledImage->myImageCache->pin( myTiledImage->tileKey( myCoord ),
+                                                   myTiledImage->findSubDomainFromBlockCoords( myCoord ) );
+      }
+      /**
+       * Copy constructor. Pins the tile once more.
+       * @param other the object to clone.
+       */
+      PinnedTile( const PinnedTile & other )
+        : myTiledImage( other.myTiledImage ), myCoord( other.myCoord )
+      {
+        myImage = myTiledImage->myImageCache->pin( myTiledImage->tileKey( myCoord ),
+                                                   myTiledImage->findSubDomainFromBlockCoords( myCoord ) );
+      }
+      /**
+       * Destructor. Unpins the tile.
+       */
+      ~PinnedTile()
+      {
+        myTiledImage->myImageCache->unpin( myTiledImage->tileKey( myCoord ) );
+      }
+      /// @return the tile image.
+      OutputImage * image() const { return myImage; }
+      /// @return the block coords of the tile.
+      const Point & blockCoords() const { return myCoord; }
+    private:
+      PinnedTile & operator=( const PinnedTile & other );
+      const Self * myTiledImage;
+      Point myCoord;
+      OutputImage * myImage;
+    };
+
+    // ----------------------- Standard services ------------------------------
+
+  public:
+
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory (see ImageFactoryFromImage or ImageFactoryFromHDF5).
+     * @param aWritePolicy alias on a write policy.
+     * @param N how many tiles we want for each dimension.
+     * @param aMaxTiles the number of tiles kept in memory.
+     * @param aNbShards the number of shards of the cache.
+     */
+    ConcurrentTiledImage( Alias<ImageFactory> anImageFactory,
+                          Alias<ImageCacheWritePolicy> aWritePolicy,
+                          typename Domain::Integer N,
+                          unsigned int aMaxTiles,
+                          unsigned int aNbShards = 16 );
+
+    /**
+     * Destructor. Flushes and detaches all the tiles.
+     */
+    ~ConcurrentTiledImage();
+
+  private:
+
+    ConcurrentTiledImage( const ConcurrentTiledImage & other );
+
+    ConcurrentTiledImage & operator=( const ConcurrentTiledImage & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /////////////////// Domains ///////////////////
+
+    /**
+     * @return a reference to the underlying image domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the block coords domain.
+     */
+    Domain domainBlockCoords() const;
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the block coords of the tile containing aPoint.
+     */
+    Point findBlockCoordsFromPoint( const Point & aPoint ) const;
+
+    /**
+     * @param aCoord block coords.
+     * @return the domain of this tile.
+     */
+    Domain findSubDomainFromBlockCoords( const Point & aCoord ) const;
+
+    /**
+     * @param aCoord block coords.
+     * @return the key of this tile in the cache.
+     */
+    Size tileKey( const Point & aCoord ) const;
+
+    /////////////////// Accessors ///////////////////
+
+    /**
+     * Get the value of the image (from cache) at aPoint. Thread-safe.
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on the image (in cache) at aPoint. Thread-safe.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * Pins a tile in the cache (loading it if necessary). Thread-safe.
+     *
+     * @param aCoord block coords.
+     * @return the pinned tile.
+     */
+    PinnedTile pinTile( const Point & aCoord ) const;
+
+    /**
+     * Loads a tile in the cache if it is not there yet. Thread-safe.
+     *
+     * @param aCoord block coords.
+     */
+    void prefetchTile( const Point & aCoord ) const;
+
+    /**
+     * Loads the (2*dimension) tiles adjacent to a tile. Within an
+     * OpenMP parallel region, each tile is loaded by a task.
+     *
+     * @param aCoord block coords.
+     */
+    void prefetchNeighbors( const Point & aCoord ) const;
+
+    /////////////////// API ///////////////////////
+
+    /**
+     * @return the number of tile loads so far.
+     */
+    unsigned int getCacheMissRead() const;
+
+    /**
+     * @return the number of accesses to tiles already in memory.
+     */
+    unsigned int getCacheHits() const;
+
+    /**
+     * Flush and detach all the tiles and reset the statistics.
+     * @pre no tile is pinned and no other thread uses the image.
+     */
+    void clearCacheAndResetCacheMisses();
+
+    /**
+     * @return the tile cache.
+     */
+    const MyImageCache & imageCache() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  protected:
+
+    /// Number of tiles per dimension (as given)
+    typename Domain::Integer myN;
+
+    /// Width of a tile (for each dimension)
+    Point mySize;
+
+    /// Number of tiles along each dimension
+    Point myNbTiles;
+
+    /// ImageFactory pointer
+    ImageFactory *myImageFactory;
+
+    /// ImageCache pointer
+    MyImageCache *myImageCache;
+
+    /// domain lower and upper bound
+    Point myLowerBound, myUpperBound;
+
+  }; // end of class ConcurrentTiledImage
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConcurrentTiledImage'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConcurrentTiledImage' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer, typename TImageFactory, typename TImageCacheWritePolicy>
+  std::ostream&
+  operator<< ( std::ostream & out, const ConcurrentTiledImage<TImageContainer, TImageFactory, TImageCacheWritePolicy> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ConcurrentTiledImage.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConcurrentTiledImage_h
+
+#undef ConcurrentTiledImage_RECURSES
+#endif // else defined(ConcurrentTiledImage_RECURSES)
@@ -116,6 +116,10 @@ public:
       
       cacheMissRead = 0;
       cacheMissWrite = 0;
+      cacheHitRead = 0;
+      cacheHitWrite = 0;
+      nbEvictions = 0;
+      nbBytesLoaded = 0;
     }
     
     /**
@@ -230,7 +234,55 @@ public:
     }
     
     /**
-     * Clear the cache and reset the cache misses
+     * Get the cacheHitRead value.
+     */
+    unsigned int getCacheHitRead() const
+    {
+        return cacheHitRead;
+    }
+    
+    /**
+     * Get the cacheHitWrite value.
+     */
+    unsigned int getCacheHitWrite() const
+    {
+        return cacheHitWrite;
+    }
+    
+    /**
+     * Inc the cacheHitRead value.
+     */
+    void incCacheHitRead()
+    {
+        cacheHitRead++;
+    }
+    
+    /**
+     * Inc the cacheHitWrite value.
+     */
+    void incCacheHitWrite()
+    {
+        cacheHitWrite++;
+    }
+    
+    /**
+     * Get the number of pages detached by update.
+     */
+    unsigned int getNbEvictions() const
+    {
+        return nbEvictions;
+    }
+    
+    /**
+     * Get the number of value bytes loaded by update.
+     */
+    DGtal::uint64_t getNbBytesLoaded() const
+    {
+        return nbBytesLoaded;
+    }
+    
+    /**
+     * Clear the cache and reset the cache misses and the other statistics
      */
     void clearCacheAndResetCacheMisses()
     {
@@ -238,6 +290,10 @@ public:
       
       cacheMissRead = 0;
       cacheMissWrite = 0;
+      cacheHitRead = 0;
+      cacheHitWrite = 0;
+      nbEvictions = 0;
+      nbBytesLoaded = 0;
     }
 
     // ------------------------- Protected Datas ------------------------------
@@ -262,6 +318,16 @@ private:
     /// cache miss values
     unsigned int cacheMissRead;
     unsigned int cacheMissWrite;
+    
+    /// cache hit values
+    unsigned int cacheHitRead;
+    unsigned int cacheHitWrite;
+    
+    /// number of pages detached
+    unsigned int nbEvictions;
+    
+    /// number of value bytes loaded in the cache
+    DGtal::uint64_t nbBytesLoaded;
 
     // ------------------------- Internals ------------------------------------
 private:
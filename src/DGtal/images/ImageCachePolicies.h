@@ -41,6 +41,9 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <deque>
+#include <list>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -266,6 +269,260 @@ protected:
     
 }; // end of class ImageCacheReadPolicyFIFO
 
+/////////////////////////////////////////////////////////////////////////////
+// Template class ImageCacheReadPolicyLRU
+/**
+ * Description of template class 'ImageCacheReadPolicyLRU' <p>
+ * \brief Aim: implements a 'LRU (Least Recently Used)' read policy cache.
+ * 
+ * The cache keeps track of all the pages in memory in a list ordered by
+ * last access, the most recently used page being at the back. Each
+ * getPage call returning a page moves it to the back.
+ * When a page needs to be replaced, the page at the front of the list
+ * (the least recently used page) is selected.
+ * 
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory.
+ * 
+ * The policy is done with 5 functions:
+ * 
+ *  - getPage :                 for getting the alias on the image that contains a point or NULL if no image in the cache contains that point
+ *  - getPage :                 for getting the alias on the image that contains a domain or NULL if no image in the cache contains that domain
+ *  - getPageToDetach :         for getting the alias on the image that we have to detach or NULL if no image have to be detached
+ *  - updateCache :             for updating the cache according to the cache policy
+ *  - clearCache :              for clearing the cache
+ */
+template <typename TImageContainer, typename TImageFactory>
+class ImageCacheReadPolicyLRU
+{
+public:
+  
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));    
+    
+    typedef TImageFactory ImageFactory;
+    
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+    
+    ImageCacheReadPolicyLRU(Alias<ImageFactory> anImageFactory, int aLRUSizeMax=10):
+       myLRUSizeMax(aLRUSizeMax), myImageFactory(&anImageFactory)
+    {
+    }
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageCacheReadPolicyLRU() {}
+    
+private:
+    
+    ImageCacheReadPolicyLRU( const ImageCacheReadPolicyLRU & other );
+    
+    ImageCacheReadPolicyLRU & operator=( const ImageCacheReadPolicyLRU & other );
+    
+public:
+    
+    /**
+     * Get the alias on the image that contains the point aPoint
+     * or NULL if no image in the cache contains the point aPoint.
+     * The page becomes the most recently used one.
+     * 
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Point & aPoint);
+    
+    /**
+     * Get the alias on the image that matchs the domain aDomain
+     * or NULL if no image in the cache matchs the domain aDomain.
+     * The page becomes the most recently used one.
+     * 
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Domain & aDomain);
+    
+    /**
+     * Get the alias on the image that we have to detach
+     * or NULL if no image have to be detached.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach();
+    
+    /**
+     * Update the cache according to the cache policy.
+     *
+     * @param aDomain the domain.
+     */
+    void updateCache(const Domain &aDomain);
+    
+    /**
+     * Clear the cache.
+     */
+    void clearCache();
+    
+protected:
+    
+    /// Alias on the images cache, least recently used first
+    std::list <ImageContainer *> myLRUCacheImages;
+    
+    /// Size max of the LRU list
+    unsigned int myLRUSizeMax;
+    
+    /// Alias on the image factory
+    ImageFactory * myImageFactory;
+    
+}; // end of class ImageCacheReadPolicyLRU
+
+/////////////////////////////////////////////////////////////////////////////
+// Template class ImageCacheReadPolicy2Q
+/**
+ * Description of template class 'ImageCacheReadPolicy2Q' <p>
+ * \brief Aim: implements a scan resistant '2Q' read policy cache
+ * (Johnson and Shasha, 1994).
+ * 
+ * Pages loaded for the first time enter a FIFO queue (A1in). Only the
+ * pages that are requested again after having been evicted from A1in,
+ * i.e. whose domain is still in a bounded history of evicted domains
+ * (A1out), enter the main LRU queue (Am). A sweep over all the tiles of
+ * a TiledImage thus only recycles the pages of A1in and does not flush
+ * the frequently used pages of Am, contrary to LRU and FIFO.
+ * When a page needs to be replaced, the oldest page of A1in is selected
+ * if A1in is over its size, the least recently used page of Am
+ * otherwise.
+ * 
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory.
+ * 
+ * The policy is done with 5 functions:
+ * 
+ *  - getPage :                 for getting the alias on the image that contains a point or NULL if no image in the cache contains that point
+ *  - getPage :                 for getting the alias on the image that contains a domain or NULL if no image in the cache contains that domain
+ *  - getPageToDetach :         for getting the alias on the image that we have to detach or NULL if no image have to be detached
+ *  - updateCache :             for updating the cache according to the cache policy
+ *  - clearCache :              for clearing the cache
+ */
+template <typename TImageContainer, typename TImageFactory>
+class ImageCacheReadPolicy2Q
+{
+public:
+  
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));    
+    
+    typedef TImageFactory ImageFactory;
+    
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+    
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory.
+     * @param aSizeMax the number of pages in memory.
+     * @param anInSizeMax the size of the A1in queue (0 means aSizeMax/4, at least 1).
+     * @param anOutSizeMax the number of evicted domains kept in A1out (0 means aSizeMax/2, at least 1).
+     */
+    ImageCacheReadPolicy2Q(Alias<ImageFactory> anImageFactory, int aSizeMax=10,
+                           int anInSizeMax=0, int anOutSizeMax=0):
+       mySizeMax(aSizeMax), myImageFactory(&anImageFactory)
+    {
+      myInSizeMax = (anInSizeMax > 0) ? anInSizeMax : std::max(aSizeMax/4, 1);
+      myOutSizeMax = (anOutSizeMax > 0) ? anOutSizeMax : std::max(aSizeMax/2, 1);
+    }
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageCacheReadPolicy2Q() {}
+    
+private:
+    
+    ImageCacheReadPolicy2Q( const ImageCacheReadPolicy2Q & other );
+    
+    ImageCacheReadPolicy2Q & operator=( const ImageCacheReadPolicy2Q & other );
+    
+public:
+    
+    /**
+     * Get the alias on the image that contains the point aPoint
+     * or NULL if no image in the cache contains the point aPoint.
+     * 
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Point & aPoint);
+    
+    /**
+     * Get the alias on the image that matchs the domain aDomain
+     * or NULL if no image in the cache matchs the domain aDomain.
+     * 
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Domain & aDomain);
+    
+    /**
+     * Get the alias on the image that we have to detach
+     * or NULL if no image have to be detached.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach();
+    
+    /**
+     * Update the cache according to the cache policy.
+     *
+     * @param aDomain the domain.
+     */
+    void updateCache(const Domain &aDomain);
+    
+    /**
+     * Clear the cache.
+     */
+    void clearCache();
+    
+protected:
+    
+    /// Bounds of a domain, as stored in the A1out history.
+    typedef std::pair<Point, Point> Bounds;
+    
+    /// Pages seen once, oldest first (A1in)
+    std::deque <ImageContainer *> myInCacheImages;
+    
+    /// Pages seen again, least recently used first (Am)
+    std::list <ImageContainer *> myMainCacheImages;
+    
+    /// Domains recently evicted from A1in, oldest first (A1out)
+    std::deque <Bounds> myOutDomains;
+    
+    /// Size max of the cache
+    unsigned int mySizeMax;
+    
+    /// Size max of A1in
+    unsigned int myInSizeMax;
+    
+    /// Size max of A1out
+    unsigned int myOutSizeMax;
+    
+    /// Alias on the image factory
+    ImageFactory * myImageFactory;
+    
+}; // end of class ImageCacheReadPolicy2Q
+
 /////////////////////////////////////////////////////////////////////////////
 // Template class ImageCacheWritePolicyWT
 /**
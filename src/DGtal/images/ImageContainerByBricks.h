@@ -0,0 +1,345 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByBricks.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageContainerByBricks.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByBricks_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByBricks.h
+#else // defined(ImageContainerByBricks_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByBricks_RECURSES
+
+#if !defined ImageContainerByBricks_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByBricks_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+#include "DGtal/images/Morton.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByBricks
+  /**
+   * Description of template class 'ImageContainerByBricks' <p>
+   * \brief Aim: Model of CImage storing the values in a dense array of
+   * cubic bricks, voxels being in Morton order within each brick.
+   *
+   * The domain is covered by a grid of bricks of side \f$ 2^L \f$ (L
+   * = \a LogBrickSize, 8 voxels by default). Bricks are stored one
+   * after the other in lexicographic order and the \f$ 2^{Ld} \f$
+   * values of a brick are stored in Morton (Z-) order, computed with
+   * Morton::interleaveBits once for all in per-axis tables. Points that
+   * are close in any direction are thus close in memory, which makes
+   * neighborhood accesses (convolutions, integral invariants, distance
+   * transform passes along the last axes) much more cache friendly
+   * than with ImageContainerBySTLVector on big volumes. The memory
+   * overhead is the padding of the last bricks along each axis.
+   *
+   * Values are accessed through operator() and setValue, or through
+   * the ranges (domain order) as any CImage. The iterators returned by
+   * \ref begin and \ref end visit the values in memory order instead,
+   * brick after brick, skipping padding voxels; their \c point()
+   * method gives the current point.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue a model of CLabel (the value type).
+   * @tparam LogBrickSize the log2 of the side of the bricks.
+   *
+   * @see ImageContainerBySTLVector, Morton
+   * @see testImageContainerByBricks.cpp
+   */
+  template <typename TDomain, typename TValue, unsigned int LogBrickSize = 3>
+  class ImageContainerByBricks
+  {
+  public:
+
+    typedef ImageContainerByBricks<TDomain,TValue,LogBrickSize> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    /// static constants
+    static const typename Domain::Dimension dimension;
+    /// The side of a brick.
+    static const Size brickSize = 1u << LogBrickSize;
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT(( CLabel<TValue> ));
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// Morton encoder used for ordering voxels within a brick.
+    typedef Morton<DGtal::uint32_t, Point> MortonEncoder;
+
+    /**
+     * Iterator on the values of the image in memory order (brick
+     * after brick), skipping the padding voxels.
+     *
+     * @tparam TImage Self or const Self.
+     * @tparam TReference Value& or const Value&.
+     */
+    template <typename TImage, typename TReference>
+    class BrickIterator
+      : public boost::iterator_facade< BrickIterator<TImage, TReference>,
+                                       Value,
+                                       boost::bidirectional_traversal_tag,
+                                       TReference >
+    {
+    public:
+      BrickIterator() : myImage( 0 ), myIndex( 0 ) {}
+      BrickIterator( TImage* anImage, Size anIndex )
+        : myImage( anImage ), myIndex( anIndex ) {}
+      /// Conversion from mutable to const iterators.
+      template <typename TOtherImage, typename TOtherReference>
+      BrickIterator( const BrickIterator<TOtherImage, TOtherReference> & other )
+        : myImage( other.image() ), myIndex( other.index() ) {}
+      /// @return the point of the current value.
+      Point point() const { return myImage->pointFromIndex( myIndex ); }
+      /// @return the index of the current value in memory.
+      Size index() const { return myIndex; }
+      /// @return the iterated image.
+      TImage* image() const { return myImage; }
+    private:
+      friend class boost::iterator_core_access;
+      TReference dereference() const { return myImage->myData[ myIndex ]; }
+      bool equal( const BrickIterator & other ) const
+      { return myIndex == other.myIndex; }
+      void increment()
+      { do ++myIndex; while ( ( myIndex < myImage->myData.size() )
+                              && ! myImage->isInsideIndex( myIndex ) ); }
+      void decrement()
+      { do --myIndex; while ( ! myImage->isInsideIndex( myIndex ) ); }
+      TImage* myImage;
+      Size myIndex;
+    };
+    typedef BrickIterator<Self, Value &> Iterator;
+    typedef BrickIterator<const Self, const Value &> ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor from a Domain.
+     *
+     * @param aDomain the image domain.
+     * @param aValue the initial value of every point.
+     */
+    ImageContainerByBricks( const Domain & aDomain, const Value & aValue = Value() );
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByBricks();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre @c it must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the image.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * @return an iterator on the first value in memory order.
+     */
+    Iterator begin();
+
+    /**
+     * @return an iterator after the last value in memory order.
+     */
+    Iterator end();
+
+    /**
+     * @return a const iterator on the first value in memory order.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator after the last value in memory order.
+     */
+    ConstIterator end() const;
+
+    // ----------------------- Brick services ---------------------------------
+  public:
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return the index of its value in memory.
+     */
+    Size index( const Point & aPoint ) const;
+
+    /**
+     * @param anIndex any index lower than the number of stored values.
+     * @return the corresponding point (may lie in the padding).
+     */
+    Point pointFromIndex( Size anIndex ) const;
+
+    /**
+     * @return the number of bricks.
+     */
+    Size nbBricks() const;
+
+    /**
+     * @return the number of stored values (with padding).
+     */
+    Size capacity() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The image domain.
+    Domain myDomain;
+    /// Number of bricks along each axis.
+    Point myNbBricks;
+    /// Strides of the brick grid along each axis.
+    std::vector<Size> myBrickStrides;
+    /// Morton offset of each local coordinate, for each axis.
+    std::vector< std::vector<Size> > myMortonOffsets;
+    /// Local point of each Morton offset.
+    std::vector<Point> myLocalPoints;
+    /// Bricks that lie completely in the domain.
+    std::vector<bool> myFullBricks;
+    /// The values.
+    std::vector<Value> myData;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param anIndex any index lower than the number of stored values.
+     * @return 'true' iff this index is not in the padding.
+     */
+    bool isInsideIndex( Size anIndex ) const;
+
+  }; // end of class ImageContainerByBricks
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByBricks'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByBricks' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue, unsigned int LogBrickSize>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByBricks<TDomain,TValue,LogBrickSize> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByBricks.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByBricks_h
+
+#undef ImageContainerByBricks_RECURSES
+#endif // else defined(ImageContainerByBricks_RECURSES)
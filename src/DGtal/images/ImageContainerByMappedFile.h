@@ -0,0 +1,281 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByMappedFile.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageContainerByMappedFile.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByMappedFile_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByMappedFile.h
+#else // defined(ImageContainerByMappedFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByMappedFile_RECURSES
+
+#if !defined ImageContainerByMappedFile_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByMappedFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByMappedFile
+  /**
+   * Description of template class 'ImageContainerByMappedFile' <p>
+   * \brief Aim: Model of CConstImage whose values are read directly
+   * in a memory mapped file.
+   *
+   * The file holds, after a header of \a offset bytes, the values of
+   * the domain points in the domain order (first coordinate fastest),
+   * each value being stored in \c sizeof(TValue) bytes, little-endian
+   * (as written by VolWriter, LongvolWriter and RawWriter). Nothing
+   * is read nor copied at construction: the operating system loads
+   * the pages of the file on demand, so that opening a huge volume is
+   * immediate and the memory used is shared with the file cache.
+   *
+   * Two modes are available:
+   * - READ_ONLY: the mapping is read-only, setValue is forbidden.
+   * - COPY_ON_WRITE: setValue modifies a private copy of the touched
+   *   pages; the file is never modified.
+   *
+   * Copies of the image share the same mapping (and thus see the
+   * values written by setValue on any of them). The mapping is
+   * released when the last copy is destroyed.
+   *
+   * On platforms without mmap (WIN32), the payload is read with a
+   * single fread into a buffer, which is still much faster than a
+   * per-voxel import.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue the value type, a model of CLabel stored as raw
+   * bytes (integers, floating-point numbers).
+   *
+   * @see VolReader::importVolMapped, LongvolReader::importLongvolMapped,
+   * RawReader::importRaw8Mapped
+   * @see testVolReader.cpp, testRawReader.cpp
+   */
+  template <typename TDomain, typename TValue>
+  class ImageContainerByMappedFile
+  {
+  public:
+
+    typedef ImageContainerByMappedFile<TDomain,TValue> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    /// static constants
+    static const typename Domain::Dimension dimension;
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT(( CLabel<TValue> ));
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    /// Mapping modes.
+    enum Mode { READ_ONLY, COPY_ON_WRITE };
+
+    /**
+     * The mapped file. Shared by the copies of an image.
+     */
+    struct Mapping
+    {
+      Mapping() : address( 0 ), length( 0 ) {}
+      ~Mapping();
+      /// Start of the mapping.
+      char* address;
+      /// Length of the mapping in bytes.
+      DGtal::uint64_t length;
+      /// Buffer used instead of mmap.
+      std::vector<char> buffer;
+    private:
+      Mapping( const Mapping & other );
+      Mapping & operator=( const Mapping & other );
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Maps the file.
+     *
+     * @param aFilename the file name.
+     * @param aDomain the image domain.
+     * @param anOffset the position of the first value in the file (size of the header).
+     * @param aMode the mapping mode.
+     *
+     * @throw IOException if the file cannot be opened or mapped, or is
+     * too short for the domain.
+     */
+    ImageContainerByMappedFile( const std::string & aFilename,
+                                const Domain & aDomain,
+                                DGtal::uint64_t anOffset = 0,
+                                Mode aMode = READ_ONLY ) throw( DGtal::IOException );
+
+    /**
+     * Destructor. Unmaps the file if this is the last copy.
+     */
+    ~ImageContainerByMappedFile();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre the image is mapped in COPY_ON_WRITE mode.
+     * @pre @c it must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the mapping mode.
+     */
+    Mode mode() const;
+
+    /**
+     * @return the first byte of the values.
+     */
+    const char* payload() const;
+
+    /**
+     * @return the number of values of the image, computed in 64 bits
+     * since large volumes have more than 2^32 values.
+     */
+    DGtal::uint64_t nbValues() const;
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return the index of its value in the file payload.
+     */
+    DGtal::uint64_t linearized( const Point & aPoint ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The image domain.
+    Domain myDomain;
+    /// The mapping mode.
+    Mode myMode;
+    /// The mapped file.
+    CountedPtr<Mapping> myMapping;
+    /// First byte of the values.
+    char* myPayload;
+    /// Extent of the domain.
+    Vector myExtent;
+    /// Number of values, product of the extents.
+    DGtal::uint64_t myNbValues;
+    /// 'true' iff the values must be byte-swapped (big-endian host).
+    bool mySwapBytes;
+
+  }; // end of class ImageContainerByMappedFile
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByMappedFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByMappedFile' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByMappedFile<TDomain,TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByMappedFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByMappedFile_h
+
+#undef ImageContainerByMappedFile_RECURSES
+#endif // else defined(ImageContainerByMappedFile_RECURSES)
@@ -0,0 +1,434 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByRuns.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageContainerByRuns.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByRuns_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByRuns.h
+#else // defined(ImageContainerByRuns_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByRuns_RECURSES
+
+#if !defined ImageContainerByRuns_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByRuns_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <utility>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByRuns
+  /**
+   * Description of template class 'ImageContainerByRuns' <p>
+   * \brief Aim: Model of CImage storing the image values as runs of
+   * constant value along the first axis (run-length encoding).
+   *
+   * The domain is cut into scanlines, i.e. the lines of points
+   * parallel to the first axis. A scanline is the sorted list of its
+   * maximal runs, a run being given by its first coordinate and its
+   * value; it extends up to the start of the next run (or to the end
+   * of the scanline). Two consecutive runs always have different
+   * values. Label and binary images that are coherent along x are thus
+   * stored in a memory proportional to their number of runs.
+   *
+   * Reading a value is a binary search in a scanline. Writing a value
+   * splits and merges runs so that they stay maximal; whole runs can
+   * be written at once with \ref setRun. As ImageContainerBySTLVector,
+   * the class provides span iterators (\ref spanBegin, \ref spanEnd)
+   * to traverse the values along any axis. The runs of a scanline are
+   * available through \ref scanline, for algorithms that only care
+   * about run ends.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue a model of CLabel (the value type).
+   *
+   * @see DigitalSetByRuns, ImageContainerBySTLVector
+   * @see testImageContainerByRuns.cpp
+   */
+  template <typename TDomain, typename TValue>
+  class ImageContainerByRuns
+  {
+  public:
+
+    typedef ImageContainerByRuns<TDomain,TValue> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef typename Point::Coordinate Coordinate;
+    typedef Point Vertex;
+
+    /// static constants
+    static const typename Domain::Dimension dimension;
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT(( CLabel<TValue> ));
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// A run: its first coordinate and its value.
+    typedef std::pair<Coordinate, Value> Run;
+    /// The sorted runs of a scanline (the first one starts at the lower bound).
+    typedef std::vector<Run> Scanline;
+
+    /**
+     * Span iterator on the values of the image along an axis, with
+     * the same interface as ImageContainerBySTLVector::SpanIterator.
+     * Values are returned by value since they are not stored per
+     * point.
+     */
+    class SpanIterator
+    {
+      friend class ImageContainerByRuns<Domain, Value>;
+
+    public:
+      typedef std::bidirectional_iterator_tag iterator_category;
+      typedef Value value_type;
+      typedef ptrdiff_t difference_type;
+      typedef Value* pointer;
+      typedef Value& reference;
+
+      /**
+       * Constructor.
+       * @param p starting point of the SpanIterator
+       * @param aDim specifies the dimension along which the iterator will iterate
+       * @param anImage pointer to the underlying image container
+       */
+      SpanIterator ( const Point & p, const Dimension aDim,
+                     ImageContainerByRuns<Domain, Value> *anImage )
+        : myImage( anImage ), myDimension( aDim ), myPoint( p )
+      {}
+
+      /**
+       * Set a value at a SpanIterator position.
+       * @param aVal the value to set.
+       */
+      void setValue ( const Value aVal )
+      {
+        myImage->setValue( myPoint, aVal );
+      }
+
+      /**
+       * @return the value at the SpanIterator position.
+       */
+      Value operator*() const
+      {
+        return ( *myImage )( myPoint );
+      }
+
+      bool operator== ( const SpanIterator &it ) const
+      {
+        return ( myPoint == it.myPoint );
+      }
+
+      bool operator!= ( const SpanIterator &it ) const
+      {
+        return ( myPoint != it.myPoint );
+      }
+
+      /// Implements the next() method.
+      void next()
+      {
+        ++myPoint[ myDimension ];
+      }
+
+      /// Implements the prev() method.
+      void prev()
+      {
+        --myPoint[ myDimension ];
+      }
+
+      SpanIterator &operator++()
+      {
+        this->next();
+        return *this;
+      }
+
+      SpanIterator operator++ ( int )
+      {
+        SpanIterator tmp = *this;
+        ++*this;
+        return tmp;
+      }
+
+      SpanIterator &operator--()
+      {
+        this->prev();
+        return *this;
+      }
+
+      SpanIterator operator-- ( int )
+      {
+        SpanIterator tmp = *this;
+        --*this;
+        return tmp;
+      }
+
+    private:
+      /// Pointer to the image.
+      ImageContainerByRuns<Domain, Value> * myImage;
+      /// Dimension of the span.
+      Dimension myDimension;
+      /// Current position.
+      Point myPoint;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor from a Domain.
+     *
+     * @param aDomain the image domain.
+     * @param aValue the initial value of every point.
+     */
+    ImageContainerByRuns( const Domain & aDomain, const Value & aValue = Value() );
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByRuns();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre @c it must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * Sets the value of the points of the scanline of \a aPoint whose
+     * first coordinate lies in [first,last].
+     *
+     * @param aPoint any point of the domain.
+     * @param first the first coordinate of the first point.
+     * @param last the first coordinate of the last point.
+     * @param aValue the value.
+     */
+    void setRun( const Point & aPoint, Coordinate first, Coordinate last,
+                 const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the image.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * Create a begin() SpanIterator at a given position in a given
+     * direction.
+     *
+     * @param aPoint the starting point of the SpanIterator.
+     * @param aDimension the dimension of the span.
+     * @return a SpanIterator
+     */
+    SpanIterator spanBegin ( const Point & aPoint, const Dimension aDimension );
+
+    /**
+     * Create an end() SpanIterator at a given position in a given
+     * direction.
+     *
+     * @param aPoint a point whose span is considered.
+     * @param aDimension the dimension of the span.
+     * @return a SpanIterator
+     */
+    SpanIterator spanEnd ( const Point & aPoint, const Dimension aDimension );
+
+    /**
+     * Returns the value of the image at a given SpanIterator position.
+     *
+     * @param it position given by a SpanIterator.
+     * @return an object of type Value.
+     */
+    Value getValue ( SpanIterator & it );
+
+    /**
+     * Set a value on an Image at a position specified by a SpanIterator.
+     *
+     * @param it position given by a SpanIterator.
+     * @param aValue the value.
+     */
+    void setValue ( SpanIterator & it, const Value & aValue );
+
+    // ----------------------- Run services -----------------------------------
+  public:
+
+    /**
+     * @return the number of scanlines of the domain.
+     */
+    Size nbScanlines() const;
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return the index of the scanline containing \a aPoint.
+     */
+    Size scanlineIndex( const Point & aPoint ) const;
+
+    /**
+     * @param i the index of a scanline.
+     * @return the runs of this scanline.
+     */
+    const Scanline & scanline( Size i ) const;
+
+    /**
+     * @param i the index of a scanline.
+     * @param x a first coordinate.
+     * @return the point of scanline \a i with first coordinate \a x.
+     */
+    Point point( Size i, Coordinate x ) const;
+
+    /**
+     * @return the total number of runs (O(number of scanlines)).
+     */
+    Size nbRuns() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The image domain.
+    Domain myDomain;
+    /// The runs of each scanline.
+    std::vector<Scanline> myScanlines;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param line the runs of a scanline.
+     * @param x a first coordinate.
+     * @return the index of the run containing \a x.
+     */
+    static Size findRun( const Scanline & line, Coordinate x );
+
+    /**
+     * Merges the consecutive runs with the same value among the runs
+     * of index in [first,last].
+     */
+    static void mergeRuns( Scanline & line, Size first, Size last );
+
+  }; // end of class ImageContainerByRuns
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByRuns'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByRuns' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByRuns<TDomain,TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByRuns.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByRuns_h
+
+#undef ImageContainerByRuns_RECURSES
+#endif // else defined(ImageContainerByRuns_RECURSES)
@@ -693,6 +693,8 @@ namespace DGtal
           myImageCache->update(d);
           tile = myImageCache->getPage(d);
         }
+      else
+        myImageCache->incCacheHitRead();
 
       return tile;
     }
@@ -713,7 +715,10 @@ namespace DGtal
       res = myImageCache->read(aPoint, aValue);
 
       if (res)
-        return aValue;
+        {
+          myImageCache->incCacheHitRead();
+          return aValue;
+        }
       else
         {
           myImageCache->incCacheMissRead();
@@ -745,7 +750,10 @@ namespace DGtal
       ASSERT(myImageFactory->domain().isInside(aPoint));
 
       if (myImageCache->write(aPoint, aValue))
-        return;
+        {
+          myImageCache->incCacheHitWrite();
+          return;
+        }
       else
         {
           myImageCache->incCacheMissWrite();
@@ -771,7 +779,39 @@ namespace DGtal
     }
 
     /**
-     * Clear the cache and reset the cache misses
+     * Get the cacheHitRead value.
+     */
+    unsigned int getCacheHitRead() const
+    {
+      return myImageCache->getCacheHitRead();
+    }
+
+    /**
+     * Get the cacheHitWrite value.
+     */
+    unsigned int getCacheHitWrite() const
+    {
+      return myImageCache->getCacheHitWrite();
+    }
+
+    /**
+     * Get the number of tiles detached from the cache.
+     */
+    unsigned int getNbEvictions() const
+    {
+      return myImageCache->getNbEvictions();
+    }
+
+    /**
+     * Get the number of value bytes loaded in the cache.
+     */
+    DGtal::uint64_t getNbBytesLoaded() const
+    {
+      return myImageCache->getNbBytesLoaded();
+    }
+
+    /**
+     * Clear the cache and reset the cache misses and the other statistics
      */
     void clearCacheAndResetCacheMisses()
     {
@@ -46,6 +46,7 @@
 #include "DGtal/base/Common.h"
 #include <boost/static_assert.hpp>
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
 #include "DGtal/base/CUnaryFunctor.h"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -80,6 +81,10 @@ namespace DGtal
    * ...
    * @endcode
    *
+   * The method "importLongvolMapped" does not copy the voxels: it
+   * returns an ImageContainerByMappedFile whose values are read
+   * directly in the memory mapped file.
+   *
    * @tparam TImageContainer the image container to use. 
    * @tparam TFunctor the type of functor used in the import (by default set to functors::Cast< TImageContainer::Value>). 
    *
@@ -94,6 +99,10 @@ namespace DGtal
     typedef TImageContainer ImageContainer;
     typedef typename TImageContainer::Value Value;    
     typedef TFunctor Functor;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    /// Type of the image returned by importLongvolMapped.
+    typedef ImageContainerByMappedFile<Domain, DGtal::uint64_t> MappedImage;
 
     BOOST_CONCEPT_ASSERT((  concepts::CUnaryFunctor<TFunctor, DGtal::uint64_t, Value > )) ;    
     BOOST_STATIC_ASSERT(ImageContainer::Domain::dimension == 3);
@@ -112,6 +121,30 @@ namespace DGtal
      */
     static ImageContainer importLongvol(const std::string & filename, 
 					const Functor & aFunctor =  Functor()) throw(DGtal::IOException);
+
+    /**
+     * Reads the header of a Longvol file.
+     *
+     * @param filename the file name.
+     * @param anOffset (returns) the position of the first voxel in the file.
+     *
+     * @return the domain of the image, as computed by importLongvol.
+     */
+    static Domain importLongvolDomain( const std::string & filename, DGtal::uint64_t & anOffset )
+      throw(DGtal::IOException);
+
+    /**
+     * Maps a Longvol file in memory without copying its voxels. The
+     * domain is computed as in importLongvol.
+     *
+     * @param filename the file name to import.
+     * @param aMode the mapping mode (READ_ONLY or COPY_ON_WRITE).
+     *
+     * @return an image reading its values in the mapped file.
+     */
+    static MappedImage importLongvolMapped( const std::string & filename,
+                                            typename MappedImage::Mode aMode = MappedImage::READ_ONLY )
+      throw(DGtal::IOException);
     
    
     
@@ -136,6 +169,17 @@ namespace DGtal
     }
 
     typedef unsigned char voxel;
+
+    /**
+     * Reads a Longvol header and computes the image domain. After
+     * the call, fin is positioned on the first voxel.
+     *
+     * @param fin the opened file.
+     * @param firstPoint (returns) the lower bound of the domain.
+     * @param lastPoint (returns) the upper bound of the domain.
+     */
+    static void readHeader( FILE * fin, Point & firstPoint, Point & lastPoint )
+      throw(DGtal::IOException);
     // This class help us to associate a field type and his value.
     // An object is a pair (type, value). You can copy and assign
     // such objects.
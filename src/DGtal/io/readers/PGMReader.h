@@ -41,8 +41,10 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -86,6 +88,12 @@ namespace DGtal
  *  board << image.domain() << set2d; // display domain and set   
  *  @endcode
  *
+ * Binary files (P5) with 8 or 16 bits per value (maximal value
+ * greater than 255, big-endian samples) are read in one block, then
+ * the functor is applied row by row. When the image is an
+ * ImageContainerBySTLVector, the rows are written directly in its
+ * storage.
+ *
  * @tparam TImageContainer the type of the image container
  *
  * @tparam TFunctor the type of functor used in the import (by default set to functors::Cast< TImageContainer::Value>) .
@@ -149,6 +157,58 @@ namespace DGtal
     static ImageContainer importPGM3D(const std::string & aFilename,
 				      const Functor & aFunctor =  Functor()) throw(DGtal::IOException);
     
+  private:
+
+    /**
+     * Reads the binary values of a P5 file and stores them in the image.
+     *
+     * @param infile the stream, positioned on the first value.
+     * @param image the image to fill.
+     * @param w the width of the image.
+     * @param h the height of the image.
+     * @param e the depth of the image (1 for 2D images).
+     * @param maxValue the maximal value given in the header.
+     * @param topbotomOrder if true, the first row is the top row
+     * (largest y coordinate) of the image.
+     * @param aFunctor the functor applied to the values.
+     *
+     * @return 'true' if all the values were read.
+     */
+    static bool importBinary( std::istream & infile, ImageContainer & image,
+                              unsigned int w, unsigned int h, unsigned int e,
+                              unsigned int maxValue, bool topbotomOrder,
+                              const Functor & aFunctor );
+
+    /**
+     * Stores the values of a row (along the first axis) in the image.
+     *
+     * @param image the image.
+     * @param aStart the first point of the row.
+     * @param aRow the values.
+     * @param aSize the number of values.
+     * @param aFunctor the functor applied to the values.
+     */
+    template <typename TImage, typename TWord>
+    static void setRow( TImage & image, typename TImage::Point aStart,
+                        const TWord * aRow, unsigned int aSize,
+                        const Functor & aFunctor );
+
+    /**
+     * Stores the values of a row (along the first axis) directly in
+     * the vector of an ImageContainerBySTLVector.
+     *
+     * @param image the image.
+     * @param aStart the first point of the row.
+     * @param aRow the values.
+     * @param aSize the number of values.
+     * @param aFunctor the functor applied to the values.
+     */
+    template <typename TDomain, typename TValue, typename TWord>
+    static void setRow( ImageContainerBySTLVector<TDomain, TValue> & image,
+                        typename TDomain::Point aStart,
+                        const TWord * aRow, unsigned int aSize,
+                        const Functor & aFunctor );
+    
     
     
  }; // end of class  PGMReader
@@ -41,8 +41,10 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/io/colormaps/BasicColorToScalarFunctors.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -86,6 +88,11 @@ namespace DGtal
  *  board << image.domain() << set2d; // display domain and set   
  *  @endcode
  *
+ * Binary files (P6) are read in one block. Samples on 16 bits
+ * (maximal value greater than 255) are scaled down to 8 bits. When
+ * the image is an ImageContainerBySTLVector, the colors of each row
+ * are converted directly into its storage.
+ *
  * @tparam TImageContainer the type of the image container
  *
  * @tparam TFunctor the type of the functor to transform the source image color into  scalar value. This functor should follows the concept 
@@ -129,7 +136,54 @@ namespace DGtal
                                      const Functor & aFunctor =  functors::ColorRGBEncoder<Value>(), 
 				     bool topbotomOrder = true) throw(DGtal::IOException);
 
-
+  private:
+
+    /**
+     * Reads the binary colors of a P6 file and stores them in the image.
+     *
+     * @param infile the stream, positioned on the first sample.
+     * @param image the image to fill.
+     * @param w the width of the image.
+     * @param h the height of the image.
+     * @param maxValue the maximal sample value given in the header.
+     * @param topbotomOrder if true, the first row is the top row of the image.
+     * @param aFunctor the functor applied to the colors.
+     *
+     * @return 'true' if all the samples were read.
+     */
+    static bool importBinary( std::istream & infile, ImageContainer & image,
+                              unsigned int w, unsigned int h, unsigned int maxValue,
+                              bool topbotomOrder, const Functor & aFunctor );
+
+    /**
+     * Stores the colors of a row (along the first axis) in the image.
+     *
+     * @param image the image.
+     * @param aStart the first point of the row.
+     * @param aRow the colors.
+     * @param aSize the number of colors.
+     * @param aFunctor the functor applied to the colors.
+     */
+    template <typename TImage>
+    static void setRow( TImage & image, typename TImage::Point aStart,
+                        const Color * aRow, unsigned int aSize,
+                        const Functor & aFunctor );
+
+    /**
+     * Stores the colors of a row (along the first axis) directly in
+     * the vector of an ImageContainerBySTLVector.
+     *
+     * @param image the image.
+     * @param aStart the first point of the row.
+     * @param aRow the colors.
+     * @param aSize the number of colors.
+     * @param aFunctor the functor applied to the colors.
+     */
+    template <typename TDomain, typename TValue>
+    static void setRow( ImageContainerBySTLVector<TDomain, TValue> & image,
+                        typename TDomain::Point aStart,
+                        const Color * aRow, unsigned int aSize,
+                        const Functor & aFunctor );
     
  }; // end of class  PPMReader
 
@@ -45,6 +45,7 @@
 #include <cstdio>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
 #include <boost/static_assert.hpp>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -77,6 +78,10 @@ namespace DGtal
    * ...
    * @endcode
    *
+   * The methods "importRaw8Mapped" and "importRaw32Mapped" do not
+   * copy the voxels: they return an ImageContainerByMappedFile whose
+   * values are read directly in the memory mapped file.
+   *
    * @tparam TImageContainer the image container to use. 
    *
    * @tparam TFunctor the type of functor used in the import (by default set to functors::Cast< TImageContainer::Value>) .
@@ -94,6 +99,11 @@ namespace DGtal
     typedef typename TImageContainer::Value Value;    
     typedef typename TImageContainer::Domain::Vector Vector;
     typedef TFunctor Functor;
+    typedef typename TImageContainer::Domain Domain;
+    /// Type of the image returned by importRaw8Mapped.
+    typedef ImageContainerByMappedFile<Domain, unsigned char> MappedImage8;
+    /// Type of the image returned by importRaw32Mapped.
+    typedef ImageContainerByMappedFile<Domain, DGtal::uint32_t> MappedImage32;
 
 
     BOOST_CONCEPT_ASSERT((  concepts::CUnaryFunctor<TFunctor, unsigned char, Value > )) ;        
@@ -138,6 +148,35 @@ namespace DGtal
 				     const Functor & aFunctor =  Functor()) throw(DGtal::IOException);
 
 
+
+    /** 
+     * Maps a Raw (8bits) file in memory without copying its values.
+     * 
+     * @param filename the file name to import.
+     * @param extent the size of the raw data set.
+     * @param aMode the mapping mode (READ_ONLY or COPY_ON_WRITE).
+     *
+     * @return an image reading its values in the mapped file.
+     */
+    static MappedImage8 importRaw8Mapped( const std::string & filename,
+                                          const Vector & extent,
+                                          typename MappedImage8::Mode aMode = MappedImage8::READ_ONLY )
+      throw(DGtal::IOException);
+
+    /** 
+     * Maps a Raw (32bits) file in memory without copying its values.
+     * 
+     * @param filename the file name to import.
+     * @param extent the size of the raw data set.
+     * @param aMode the mapping mode (READ_ONLY or COPY_ON_WRITE).
+     *
+     * @return an image reading its values in the mapped file.
+     */
+    static MappedImage32 importRaw32Mapped( const std::string & filename,
+                                            const Vector & extent,
+                                            typename MappedImage32::Mode aMode = MappedImage32::READ_ONLY )
+      throw(DGtal::IOException);
+
     
   private:
 
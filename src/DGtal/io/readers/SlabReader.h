@@ -0,0 +1,285 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SlabReader.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module SlabReader.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SlabReader_RECURSES)
+#error Recursive header files inclusion detected in SlabReader.h
+#else // defined(SlabReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SlabReader_RECURSES
+
+#if !defined SlabReader_h
+/** Prevents repeated inclusion of headers. */
+#define SlabReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <cstdio>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SlabReader
+  /**
+   * Description of template class 'SlabReader' <p>
+   * \brief Aim: reads a 3D volume stored in a file slab by slab, a slab
+   * being a set of consecutive Z-planes, so that algorithms working on
+   * a neighborhood of each voxel may process volumes bigger than the
+   * memory.
+   *
+   * The file must hold, after a header of \a offset bytes, the values
+   * of the domain points in the domain order (x fastest, then y, then
+   * z), each value being a little-endian integer of type TWord. This is
+   * the layout of Vol (TWord = unsigned char), Longvol (TWord =
+   * DGtal::uint64_t) and raw (RawWriter) files. The domain and offset
+   * of Vol and Longvol files are given by VolReader::importVolDomain
+   * and LongvolReader::importLongvolDomain.
+   *
+   * Slab \a i covers the Z-planes [ z0 + i*depth, z0 + (i+1)*depth - 1 ]
+   * (its core domain), extended by \a halo planes on both sides and
+   * clipped to the domain.
+   *
+   * The method process calls a consumer on each slab in turn. When
+   * WITH_OPENMP is defined, the next slab is read by another thread
+   * while the consumer processes the current one, so that at most two
+   * slabs are in memory.
+   *
+   * @code
+   * struct Counter {
+   *   void operator()( const Image & slab, const Z3i::Domain & core )
+   *   { ... only count the voxels of core, the others are the halo ... }
+   * };
+   * DGtal::uint64_t offset;
+   * Z3i::Domain domain = VolReader<Image>::importVolDomain( "big.vol", offset );
+   * SlabReader<Image> reader( "big.vol", domain, offset, 16, 1 );
+   * Counter counter;
+   * reader.process( counter );
+   * @endcode
+   *
+   * @tparam TImageContainer the type of the slab images, a model of
+   * CImage on a 3D HyperRectDomain, which must hold a copy of the
+   * domain given at construction (not ImageContainerBySTLMap).
+   * @tparam TWord the type of the values in the file (an unsigned integer type).
+   * @tparam TFunctor the type of functor used to cast the file values
+   * into image values (by default functors::Cast< TImageContainer::Value >).
+   *
+   * @see SlabWriter, testSlabReader.cpp
+   */
+  template <typename TImageContainer,
+            typename TWord = unsigned char,
+            typename TFunctor = functors::Cast< typename TImageContainer::Value > >
+  class SlabReader
+  {
+  public:
+    typedef SlabReader<TImageContainer, TWord, TFunctor> Self;
+
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CUnaryFunctor<TFunctor, TWord, typename TImageContainer::Value> ));
+    BOOST_STATIC_ASSERT( TImageContainer::Domain::dimension == 3 );
+
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename ImageContainer::Point Point;
+    typedef typename ImageContainer::Value Value;
+    typedef typename Domain::Integer Integer;
+    typedef TWord Word;
+    typedef TFunctor Functor;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Opens the file.
+     *
+     * @param aFilename the file name.
+     * @param aDomain the domain of the whole volume.
+     * @param anOffset the position of the first value in the file.
+     * @param aSlabDepth the number of Z-planes of each slab (without halo).
+     * @param aHalo the number of Z-planes added on both sides of each slab.
+     * @param aFunctor the functor used to cast the file values.
+     *
+     * @throw IOException if the file cannot be opened.
+     */
+    SlabReader( const std::string & aFilename, const Domain & aDomain,
+                DGtal::uint64_t anOffset, Integer aSlabDepth, Integer aHalo = 0,
+                const Functor & aFunctor = Functor() ) throw( DGtal::IOException );
+
+    /**
+     * Destructor. Closes the file.
+     */
+    ~SlabReader();
+
+  private:
+
+    SlabReader( const SlabReader & other );
+
+    SlabReader & operator=( const SlabReader & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the domain of the whole volume.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the number of slabs.
+     */
+    Integer nbSlabs() const;
+
+    /**
+     * @param i the index of a slab.
+     * @return the Z-planes of this slab, without the halo.
+     */
+    Domain coreDomain( Integer i ) const;
+
+    /**
+     * @param i the index of a slab.
+     * @return the Z-planes of this slab with its halo, clipped to the domain.
+     */
+    Domain slabDomain( Integer i ) const;
+
+    /**
+     * Reads a slab with its halo. Not thread-safe.
+     *
+     * @param i the index of a slab.
+     * @return a new image on slabDomain( i ), which must be deleted by the caller.
+     *
+     * @throw IOException if the file is too short.
+     */
+    ImageContainer * readSlab( Integer i ) throw( DGtal::IOException );
+
+    /**
+     * Calls aConsumer( slab, core ) on each slab in increasing Z
+     * order, core being the coreDomain of the slab. The next slab is
+     * read during the call when WITH_OPENMP is defined. If the
+     * consumer throws, the slabs are deleted and process throws in
+     * turn, after the next slab is read.
+     *
+     * @tparam TConsumer the type of the consumer.
+     * @param aConsumer the consumer.
+     *
+     * @throw IOException if the file is too short or if the consumer
+     * throws an IOException.
+     * @throw std::runtime_error with the message of the consumer
+     * exception if the consumer throws another exception.
+     */
+    template <typename TConsumer>
+    void process( TConsumer & aConsumer );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Stores the values in the image, in the domain order.
+     * @param anImage the image.
+     * @param aValues the values read in the file.
+     */
+    template <typename TImage>
+    void setValues( TImage & anImage, const std::vector<Word> & aValues ) const;
+
+    /**
+     * Stores the values directly in the vector of an
+     * ImageContainerBySTLVector.
+     * @param anImage the image.
+     * @param aValues the values read in the file.
+     */
+    template <typename TDomain, typename TValue>
+    void setValues( ImageContainerBySTLVector<TDomain, TValue> & anImage,
+                    const std::vector<Word> & aValues ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The file name.
+    std::string myFilename;
+    /// The opened file.
+    FILE * myFile;
+    /// The domain of the volume.
+    Domain myDomain;
+    /// The position of the first value in the file.
+    DGtal::uint64_t myOffset;
+    /// The number of Z-planes of a slab.
+    Integer mySlabDepth;
+    /// The number of Z-planes of the halo.
+    Integer myHalo;
+    /// The functor used to cast the file values.
+    Functor myFunctor;
+
+  }; // end of class SlabReader
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SlabReader'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SlabReader' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer, typename TWord, typename TFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out, const SlabReader<TImageContainer, TWord, TFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/SlabReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SlabReader_h
+
+#undef SlabReader_RECURSES
+#endif // else defined(SlabReader_RECURSES)
@@ -45,6 +45,7 @@
 #include <cstdio>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -78,6 +79,16 @@ namespace DGtal
    * ...
    * @endcode
    *
+   * The method "importVolMapped" does not copy the voxels: it
+   * returns an ImageContainerByMappedFile whose values are read
+   * directly in the memory mapped file, which is useful for volumes
+   * that do not fit in memory or that are only partially visited.
+   *
+   * @code
+   * VolReader<Image>::MappedImage mapped = VolReader<Image>::importVolMapped("data.vol");
+   * unsigned char v = mapped( Point( 10, 20, 30 ) );
+   * @endcode
+   *
    * @tparam TImageContainer the image container to use. 
    *
    * @tparam TFunctor the type of functor used in the import (by default set to functors::Cast< TImageContainer::Value>) .
@@ -92,6 +103,10 @@ namespace DGtal
     typedef TImageContainer ImageContainer;
     typedef typename TImageContainer::Value Value;
     typedef TFunctor Functor;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    /// Type of the image returned by importVolMapped.
+    typedef ImageContainerByMappedFile<Domain, unsigned char> MappedImage;
     
     BOOST_CONCEPT_ASSERT((  concepts::CUnaryFunctor<TFunctor, unsigned char, Value > )) ;    
 
@@ -112,12 +127,48 @@ namespace DGtal
      */
     static ImageContainer importVol(const std::string & filename, 
 				    const Functor & aFunctor =  Functor()) throw(DGtal::IOException);
+
+    /**
+     * Reads the header of a Vol file.
+     *
+     * @param filename the file name.
+     * @param anOffset (returns) the position of the first voxel in the file.
+     *
+     * @return the domain of the image, as computed by importVol.
+     */
+    static Domain importVolDomain( const std::string & filename, DGtal::uint64_t & anOffset )
+      throw(DGtal::IOException);
+
+    /**
+     * Maps a Vol file in memory without copying its voxels. The
+     * domain is computed as in importVol.
+     *
+     * @param filename the file name to import.
+     * @param aMode the mapping mode (READ_ONLY or COPY_ON_WRITE).
+     *
+     * @return an image reading its values in the mapped file.
+     */
+    static MappedImage importVolMapped( const std::string & filename,
+                                        typename MappedImage::Mode aMode = MappedImage::READ_ONLY )
+      throw(DGtal::IOException);
     
    
     
   private:
 
     typedef unsigned char voxel;
+
+    /**
+     * Reads a Vol header and computes the image domain. After the
+     * call, fin is positioned on the first voxel.
+     *
+     * @param fin the opened file.
+     * @param firstPoint (returns) the lower bound of the domain.
+     * @param lastPoint (returns) the upper bound of the domain.
+     */
+    static void readHeader( FILE * fin, Point & firstPoint, Point & lastPoint )
+      throw(DGtal::IOException);
+
     // This class help us to associate a field type and his value.
     // An object is a pair (type, value). You can copy and assign
     // such objects.
@@ -73,6 +73,7 @@ namespace DGtal
     typedef TImage Image;
     typedef typename TImage::Value Value;
     typedef TFunctor Functor;
+    typedef typename TImage::Domain Domain;
     typedef DGtal::uint64_t ValueLongvol;
     
     BOOST_CONCEPT_ASSERT((  concepts::CUnaryFunctor<TFunctor, Value, ValueLongvol> )) ;    
@@ -89,6 +90,15 @@ namespace DGtal
      */
     static bool exportLongvol(const std::string & filename, const Image &aImage, 
 			      const Functor & aFunctor = Functor()) throw(DGtal::IOException);
+
+    /** 
+     * Writes the Longvol header of an image (up to the final ".\n"
+     * line), the values being then expected in the domain order.
+     * 
+     * @param out the output stream.
+     * @param aDomain the domain of the image.
+     */
+    static void exportLongvolHeader(std::ostream & out, const Domain & aDomain);
     
     
   private: 
@@ -42,11 +42,13 @@
 // Inclusions
 #include <iostream>
 #include <string>
+#include <vector>
 #include <boost/static_assert.hpp>
 #include <boost/type_traits.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
 #include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -79,6 +81,10 @@ namespace DGtal
    * 
    * @endcode
    *
+   * In binary mode (P5), the values are converted row by row into a
+   * buffer written in one block; rows of an ImageContainerBySTLVector
+   * are read directly in its storage.
+   *
    * @tparam TImage the Image type.
    * @tparam TFunctor the type of functor used in the export.
    *
@@ -125,6 +131,36 @@ namespace DGtal
     static bool exportPGM3D(const std::string & filename, const Image &aImage, 
 			    const Functor & aFunctor = Functor(), bool saveASCII=false);
     
+  private:
+
+    /**
+     * Converts the values of a row (along the first axis) of an image.
+     *
+     * @param aImage the image.
+     * @param aStart the first point of the row.
+     * @param aSize the number of values.
+     * @param aRow (returns) the converted values.
+     * @param aFunctor the functor used to cast image values.
+     */
+    template <typename TAnyImage>
+    static void getRow( const TAnyImage & aImage, typename TAnyImage::Point aStart,
+                        unsigned int aSize, char * aRow, const Functor & aFunctor );
+
+    /**
+     * Converts the values of a row (along the first axis) read
+     * directly in the vector of an ImageContainerBySTLVector.
+     *
+     * @param aImage the image.
+     * @param aStart the first point of the row.
+     * @param aSize the number of values.
+     * @param aRow (returns) the converted values.
+     * @param aFunctor the functor used to cast image values.
+     */
+    template <typename TDomain, typename TValue>
+    static void getRow( const ImageContainerBySTLVector<TDomain, TValue> & aImage,
+                        typename TDomain::Point aStart,
+                        unsigned int aSize, char * aRow, const Functor & aFunctor );
+    
   };
 }//namespace
 
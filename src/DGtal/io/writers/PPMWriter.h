@@ -42,12 +42,14 @@
 // Inclusions
 #include <iostream>
 #include <string>
+#include <vector>
 #include <boost/static_assert.hpp>
 #include <boost/type_traits.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/io/Color.h"
 #include "DGtal/base/CUnaryFunctor.h"
 #include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -63,6 +65,9 @@ namespace DGtal
    *
    * A functor can be specified to convert image values to DGtal::Color values.
    *
+   * 2D images may also be exported in binary mode (P6): the colors
+   * are then converted row by row into a buffer written in one block.
+   *
    * @tparam TImage the Image type.
    * @tparam TFunctor the type of functor used in the export.
    *
@@ -86,11 +91,14 @@ namespace DGtal
      * @param aImage the image to export
      * @param aFunctor  functor used to cast image values
      * @param topbottomOrder true if top to bottom order is prefered (default: true)
+     * @param saveASCII true to save the colors as ASCII values (P3), false to
+     * save them as bytes (P6) (default: true).
      *
      * @return true if no errors occur.
      */
     static bool exportPPM(const std::string & filename, const Image &aImage, 
-			  const Functor & aFunctor = Functor(), bool topbottomOrder=true);
+			  const Functor & aFunctor = Functor(), bool topbottomOrder=true,
+			  bool saveASCII=true);
   
 
     /** 
@@ -105,6 +113,37 @@ namespace DGtal
     static bool exportPPM3D(const std::string & filename, const Image &aImage, 
 			    const Functor & aFunctor = Functor());
     
+  private:
+
+    /**
+     * Converts the values of a row (along the first axis) of an image
+     * into RGB bytes.
+     *
+     * @param aImage the image.
+     * @param aStart the first point of the row.
+     * @param aSize the number of values.
+     * @param aRow (returns) the 3*aSize color components.
+     * @param aFunctor the functor used to get the colors.
+     */
+    template <typename TAnyImage>
+    static void getRow( const TAnyImage & aImage, typename TAnyImage::Point aStart,
+                        unsigned int aSize, char * aRow, const Functor & aFunctor );
+
+    /**
+     * Converts into RGB bytes the values of a row (along the first
+     * axis) read directly in the vector of an ImageContainerBySTLVector.
+     *
+     * @param aImage the image.
+     * @param aStart the first point of the row.
+     * @param aSize the number of values.
+     * @param aRow (returns) the 3*aSize color components.
+     * @param aFunctor the functor used to get the colors.
+     */
+    template <typename TDomain, typename TValue>
+    static void getRow( const ImageContainerBySTLVector<TDomain, TValue> & aImage,
+                        typename TDomain::Point aStart,
+                        unsigned int aSize, char * aRow, const Functor & aFunctor );
+    
   };
 }//namespace
 
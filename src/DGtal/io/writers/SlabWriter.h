@@ -0,0 +1,277 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SlabWriter.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module SlabWriter.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SlabWriter_RECURSES)
+#error Recursive header files inclusion detected in SlabWriter.h
+#else // defined(SlabWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SlabWriter_RECURSES
+
+#if !defined SlabWriter_h
+/** Prevents repeated inclusion of headers. */
+#define SlabWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SlabWriter
+  /**
+   * Description of template class 'SlabWriter' <p>
+   * \brief Aim: writes a 3D volume slab by slab, a slab being a set
+   * of consecutive Z-planes, so that the whole volume never has to be
+   * in memory. This is the counterpart of SlabReader.
+   *
+   * The header (Vol or Longvol format, nothing for raw files) is
+   * written at construction. Each call to writeSlab then appends the
+   * Z-planes of a core domain, which must follow the planes already
+   * written. The values are cast with the functor into TWord and
+   * written in little-endian, as VolWriter, LongvolWriter and
+   * RawWriter do.
+   *
+   * Together with SlabReader::process, it gives a bounded memory
+   * pipeline: the consumer filters the current slab and writes its
+   * core, while the next slab is read.
+   *
+   * @code
+   * struct Filter {
+   *   SlabWriter<Image> & writer;
+   *   void operator()( const Image & slab, const Z3i::Domain & core )
+   *   {
+   *     Image result( slab.domain() );
+   *     ... compute result on core, using the halo of slab ...
+   *     writer.writeSlab( result, core );
+   *   }
+   * };
+   * @endcode
+   *
+   * @tparam TImageContainer the type of the slab images, a model of
+   * CImage on a 3D HyperRectDomain.
+   * @tparam TWord the type of the values in the file (an unsigned
+   * integer type: unsigned char for Vol, DGtal::uint64_t for Longvol).
+   * @tparam TFunctor the type of functor used to cast the image values
+   * into file values (by default functors::Cast< TWord >).
+   *
+   * @see SlabReader, testSlabWriter.cpp
+   */
+  template <typename TImageContainer,
+            typename TWord = unsigned char,
+            typename TFunctor = functors::Cast< TWord > >
+  class SlabWriter
+  {
+  public:
+    typedef SlabWriter<TImageContainer, TWord, TFunctor> Self;
+
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CUnaryFunctor<TFunctor, typename TImageContainer::Value, TWord> ));
+    BOOST_STATIC_ASSERT( TImageContainer::Domain::dimension == 3 );
+
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename ImageContainer::Point Point;
+    typedef typename ImageContainer::Value Value;
+    typedef typename Domain::Integer Integer;
+    typedef TWord Word;
+    typedef TFunctor Functor;
+
+    /// File formats.
+    enum Format { RAW, VOL, LONGVOL };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Creates the file and writes its header.
+     *
+     * @param aFilename the file name.
+     * @param aDomain the domain of the whole volume.
+     * @param aFormat the file format (VOL requires a TWord of 1 byte,
+     * LONGVOL a TWord of 8 bytes).
+     * @param aFunctor the functor used to cast the image values.
+     *
+     * @throw IOException if the file cannot be created or if TWord
+     * does not fit the format.
+     */
+    SlabWriter( const std::string & aFilename, const Domain & aDomain,
+                Format aFormat = RAW,
+                const Functor & aFunctor = Functor() ) throw( DGtal::IOException );
+
+    /**
+     * Destructor. Closes the file.
+     */
+    ~SlabWriter();
+
+  private:
+
+    SlabWriter( const SlabWriter & other );
+
+    SlabWriter & operator=( const SlabWriter & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the domain of the whole volume.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the Z coordinate of the next plane to write.
+     */
+    Integer nextPlane() const;
+
+    /**
+     * @return 'true' iff all the planes of the domain have been written.
+     */
+    bool isComplete() const;
+
+    /**
+     * Appends the Z-planes of aCore to the file.
+     *
+     * @pre aCore is included in the domain of aSlab, spans the whole
+     * domain in X and Y and starts at nextPlane().
+     *
+     * @param aSlab an image holding the values to write.
+     * @param aCore the Z-planes to write.
+     *
+     * @throw IOException in case of write error.
+     */
+    void writeSlab( const ImageContainer & aSlab, const Domain & aCore )
+      throw( DGtal::IOException );
+
+    /**
+     * Appends all the Z-planes of aSlab to the file.
+     *
+     * @param aSlab an image holding the values to write.
+     *
+     * @throw IOException in case of write error.
+     */
+    void writeSlab( const ImageContainer & aSlab ) throw( DGtal::IOException );
+
+    /**
+     * Closes the file.
+     *
+     * @throw IOException if some planes have not been written.
+     */
+    void close() throw( DGtal::IOException );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Casts the values of aCore in the domain order.
+     * @param anImage the image.
+     * @param aCore the domain to scan.
+     * @param aValues (returns) the file values.
+     */
+    template <typename TImage>
+    void getValues( const TImage & anImage, const Domain & aCore,
+                    std::vector<Word> & aValues ) const;
+
+    /**
+     * Casts the values of aCore directly from the vector of an
+     * ImageContainerBySTLVector.
+     * @param anImage the image.
+     * @param aCore the domain to scan.
+     * @param aValues (returns) the file values.
+     */
+    template <typename TDomain, typename TValue>
+    void getValues( const ImageContainerBySTLVector<TDomain, TValue> & anImage,
+                    const Domain & aCore, std::vector<Word> & aValues ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The file name.
+    std::string myFilename;
+    /// The output stream.
+    std::ofstream myStream;
+    /// The domain of the volume.
+    Domain myDomain;
+    /// The file format.
+    Format myFormat;
+    /// The Z coordinate of the next plane to write.
+    Integer myNextPlane;
+    /// The functor used to cast the image values.
+    Functor myFunctor;
+
+  }; // end of class SlabWriter
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SlabWriter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SlabWriter' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer, typename TWord, typename TFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out, const SlabWriter<TImageContainer, TWord, TFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/SlabWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SlabWriter_h
+
+#undef SlabWriter_RECURSES
+#endif // else defined(SlabWriter_RECURSES)
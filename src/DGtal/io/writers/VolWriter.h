@@ -71,6 +71,7 @@ namespace DGtal
     typedef TImage Image;
     typedef typename TImage::Value Value;
     typedef TFunctor Functor;
+    typedef typename TImage::Domain Domain;
     
     BOOST_CONCEPT_ASSERT((  concepts::CUnaryFunctor<TFunctor, Value, unsigned char> )) ;    
     BOOST_STATIC_ASSERT(TImage::Domain::dimension == 3);
@@ -85,6 +86,15 @@ namespace DGtal
      */
     static bool exportVol(const std::string & filename, const Image &aImage, 
 			  const Functor & aFunctor = Functor()) throw(DGtal::IOException);
+
+    /** 
+     * Writes the Vol header of an image (up to the final ".\n"
+     * line), the voxels being then expected in the domain order.
+     * 
+     * @param out the output stream.
+     * @param aDomain the domain of the image.
+     */
+    static void exportVolHeader(std::ostream & out, const Domain & aDomain);
   };
 }//namespace
 
@@ -0,0 +1,462 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitVector.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module DigitalSetByBitVector.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByBitVector_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitVector.h
+#else // defined(DigitalSetByBitVector_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitVector_RECURSES
+
+#if !defined DigitalSetByBitVector_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitVector_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/base/Bits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitVector
+  /**
+    Description of template class 'DigitalSetByBitVector' <p> \brief
+    Aim: Realizes the concept CDigitalSet by storing one bit per point
+    of a rectangular domain.
+
+    Points are linearized in the lexicographic order of the domain
+    (first coordinate varies fastest), as in
+    ImageContainerBySTLVector. Membership tests, insertions and
+    removals are thus O(1) and the set uses \f$|D|/8\f$ bytes whatever
+    its number of elements, which makes it the representation of
+    choice for dense sets in big domains (e.g. segmentations of
+    volumes). Union, intersection, difference and complement are
+    computed 64 points at a time.
+
+    Iterators visit the points of the set in the order of the domain,
+    by scanning for set bits. Points outside the domain are never in
+    the set (they may be tested with \c find or \c operator(), but not
+    inserted).
+
+    @tparam TDomain a HyperRectDomain.
+    @see CDigitalSet, DigitalSetSelector
+    @see testDigitalSetByBitVector.cpp
+   */
+  template <typename TDomain>
+  class DigitalSetByBitVector
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByBitVector<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    /// The type of the words storing the bits.
+    typedef DGtal::uint64_t Word;
+
+    /**
+     * Bidirectional readable iterator on the points of the set. The
+     * point is computed from the position of the set bit, hence it
+     * is returned by value.
+     */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       boost::bidirectional_traversal_tag,
+                                       Point >
+    {
+    public:
+      ConstIterator() : mySet( 0 ), myIndex( 0 ) {}
+      ConstIterator( const Self* aSet, Size anIndex )
+        : mySet( aSet ), myIndex( anIndex ) {}
+      /// @return the linearized index of the pointed point.
+      Size index() const { return myIndex; }
+    private:
+      friend class boost::iterator_core_access;
+      Point dereference() const { return mySet->delinearized( myIndex ); }
+      bool equal( const ConstIterator & other ) const
+      { return myIndex == other.myIndex; }
+      void increment() { myIndex = mySet->nextIndex( myIndex + 1 ); }
+      void decrement() { myIndex = mySet->previousIndex( myIndex ); }
+      const Self* mySet;
+      Size myIndex;
+    };
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByBitVector();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByBitVector( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitVector ( const DigitalSetByBitVector & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector & operator= ( const DigitalSetByBitVector & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy-on-write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set (O(1)).
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set. Same as \ref insert since
+     * inserting twice a point has no effect.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * Set union to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector & operator+= ( const DigitalSetByBitVector & aSet );
+
+    /**
+     * Set intersection to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector & operator&= ( const DigitalSetByBitVector & aSet );
+
+    /**
+     * Set difference to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector & operator-= ( const DigitalSetByBitVector & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByBitVector & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Linearization services -------------------------
+  public:
+
+    /**
+     * @param p any point of the domain.
+     * @return the index of the bit of \a p.
+     */
+    Size linearized( const Point & p ) const;
+
+    /**
+     * @param index any index lower than the size of the domain.
+     * @return the point corresponding to this index.
+     */
+    Point delinearized( Size index ) const;
+
+    /**
+     * @param index any index.
+     * @return the smallest index greater or equal to \a index whose
+     * bit is set, or the size of the domain if there is none.
+     */
+    Size nextIndex( Size index ) const;
+
+    /**
+     * @param index any index.
+     * @return the greatest index smaller than \a index whose bit is
+     * set (undefined if there is none).
+     */
+    Size previousIndex( Size index ) const;
+
+    /**
+     * @return the words storing the bits of the set (read-only).
+     */
+    const std::vector<Word> & words() const;
+
+    /**
+     * Replaces the bits of the set by the given words, e.g. computed
+     * 64 points at a time by several threads. The previous words of
+     * the set are returned in \a someWords.
+     *
+     * @param[in,out] someWords the new words of the set (as many as
+     * the set has), bits after the last point of the domain are
+     * ignored.
+     */
+    void swapWords( std::vector<Word> & someWords );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// Lower bound of the domain.
+    Point myLowerBound;
+    /// Upper bound of the domain.
+    Point myUpperBound;
+    /// Strides of the linearization along each axis.
+    std::vector<Size> myStrides;
+    /// The number of points of the domain.
+    Size myNbBits;
+    /// The bits of the set.
+    std::vector<Word> myWords;
+    /// The number of elements of the set.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitVector();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p any point.
+     * @return 'true' iff \a p lies in the domain.
+     */
+    bool isInDomain( const Point & p ) const;
+
+    /**
+     * @param other any other set.
+     * @return 'true' iff both sets have the same domain bounds.
+     */
+    bool hasSameDomain( const DigitalSetByBitVector & other ) const;
+
+    /**
+     * Clears the bits after the last point of the domain and
+     * recomputes the number of elements.
+     */
+    void updateSize();
+
+  }; // end of class DigitalSetByBitVector
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitVector'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitVector' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSetByBitVector<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitVector.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitVector_h
+
+#undef DigitalSetByBitVector_RECURSES
+#endif // else defined(DigitalSetByBitVector_RECURSES)
@@ -0,0 +1,504 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByRuns.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module DigitalSetByRuns.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByRuns_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByRuns.h
+#else // defined(DigitalSetByRuns_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByRuns_RECURSES
+
+#if !defined DigitalSetByRuns_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByRuns_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByRuns
+  /**
+    Description of template class 'DigitalSetByRuns' <p> \brief
+    Aim: Realizes the concept CDigitalSet by storing the runs of
+    consecutive points along the first axis of a rectangular domain
+    (run-length encoding).
+
+    The domain is cut into scanlines, i.e. the lines of points
+    parallel to the first axis. Each scanline stores the sorted list
+    of its maximal runs, a run being the closed interval of first
+    coordinates [first,last] of consecutive points of the set. The
+    memory is thus proportional to the number of runs and not to the
+    number of points, which is very effective for segmentations that
+    are coherent along x.
+
+    Membership is a binary search in a scanline. Insertions and
+    removals keep runs maximal (merging or splitting them). Union,
+    intersection and difference are computed by merging the run lists
+    of each scanline. Iterators visit the points in the order of the
+    domain (first coordinate varies fastest) and the runs themselves
+    are available through \ref scanline, for algorithms that only care
+    about run ends.
+
+    @tparam TDomain a HyperRectDomain.
+    @see CDigitalSet, ImageContainerByRuns
+    @see testDigitalSetByRuns.cpp
+   */
+  template <typename TDomain>
+  class DigitalSetByRuns
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByRuns<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Point::Coordinate Coordinate;
+    /// A run: the closed interval [first,last] of first coordinates.
+    typedef std::pair<Coordinate, Coordinate> Run;
+    /// The sorted, disjoint and non adjacent runs of a scanline.
+    typedef std::vector<Run> Scanline;
+
+    /**
+     * Bidirectional readable iterator on the points of the set. The
+     * point is computed from the scanline and the current run, hence
+     * it is returned by value.
+     */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       boost::bidirectional_traversal_tag,
+                                       Point >
+    {
+    public:
+      ConstIterator() : mySet( 0 ), myLine( 0 ), myRun( 0 ), myX( 0 ) {}
+      ConstIterator( const Self* aSet, Size aLine, Size aRun, Coordinate x )
+        : mySet( aSet ), myLine( aLine ), myRun( aRun ), myX( x ) {}
+      /// @return the index of the scanline of the pointed point.
+      Size line() const { return myLine; }
+    private:
+      friend class boost::iterator_core_access;
+      friend class DigitalSetByRuns<TDomain>;
+      Point dereference() const { return mySet->point( myLine, myX ); }
+      bool equal( const ConstIterator & other ) const
+      { return ( myLine == other.myLine ) && ( myRun == other.myRun )
+          && ( myX == other.myX ); }
+      void increment();
+      void decrement();
+      const Self* mySet;
+      Size myLine;
+      Size myRun;
+      Coordinate myX;
+    };
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByRuns();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByRuns( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByRuns ( const DigitalSetByRuns & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator= ( const DigitalSetByRuns & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy-on-write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set (O(1)).
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set. Same as \ref insert.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds the points [first,last] of the scanline of [p] to this set.
+     *
+     * @param p any point of the domain.
+     * @param first the first coordinate of the first point.
+     * @param last the first coordinate of the last point.
+     */
+    void insertRun( const Point & p, Coordinate first, Coordinate last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * Set union to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator+= ( const DigitalSetByRuns & aSet );
+
+    /**
+     * Set intersection to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator&= ( const DigitalSetByRuns & aSet );
+
+    /**
+     * Set difference to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator-= ( const DigitalSetByRuns & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByRuns & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Run services -----------------------------------
+  public:
+
+    /**
+     * @return the number of scanlines of the domain.
+     */
+    Size nbScanlines() const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the index of the scanline containing \a p.
+     */
+    Size scanlineIndex( const Point & p ) const;
+
+    /**
+     * @param i the index of a scanline.
+     * @return the runs of this scanline.
+     */
+    const Scanline & scanline( Size i ) const;
+
+    /**
+     * @param i the index of a scanline.
+     * @param x a first coordinate.
+     * @return the point of scanline \a i with first coordinate \a x.
+     */
+    Point point( Size i, Coordinate x ) const;
+
+    /**
+     * @return the total number of runs (O(number of scanlines)).
+     */
+    Size nbRuns() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// Lower bound of the domain.
+    Point myLowerBound;
+    /// Upper bound of the domain.
+    Point myUpperBound;
+    /// The runs of each scanline.
+    std::vector<Scanline> myScanlines;
+    /// The number of elements of the set.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByRuns();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// The set operations computed by \ref combine.
+    enum CombineOp { Union, Intersection, Difference };
+
+    /**
+     * @param p any point.
+     * @return 'true' iff \a p lies in the domain.
+     */
+    bool isInDomain( const Point & p ) const;
+
+    /**
+     * @param other any other set.
+     * @return 'true' iff both sets have the same domain bounds.
+     */
+    bool hasSameDomain( const DigitalSetByRuns & other ) const;
+
+    /**
+     * @param line the runs of a scanline.
+     * @param x a first coordinate.
+     * @return the index of the run containing \a x, or line.size().
+     */
+    static Size findRun( const Scanline & line, Coordinate x );
+
+    /**
+     * @param line the runs of a scanline.
+     * @return the number of points of the scanline.
+     */
+    static Size count( const Scanline & line );
+
+    /**
+     * Appends the run [first,last] to \a line, merging it with the
+     * last run if they are adjacent.
+     */
+    static void append( Scanline & line, Coordinate first, Coordinate last );
+
+    /**
+     * Merges two scanlines.
+     * @param a the runs of a first scanline.
+     * @param b the runs of a second scanline.
+     * @param op the set operation.
+     * @param out (returns) the resulting runs.
+     */
+    static void combine( const Scanline & a, const Scanline & b, CombineOp op,
+                         Scanline & out );
+
+    /**
+     * Applies \ref combine to every scanline and recomputes the size.
+     * @param other a set with the same domain.
+     * @param op the set operation.
+     */
+    void combineWith( const DigitalSetByRuns & other, CombineOp op );
+
+    /**
+     * @param i the index of a scanline.
+     * @return the first non empty scanline with index greater or equal
+     * to \a i, or nbScanlines().
+     */
+    Size nextLine( Size i ) const;
+
+  }; // end of class DigitalSetByRuns
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByRuns'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByRuns' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSetByRuns<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByRuns.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByRuns_h
+
+#undef DigitalSetByRuns_RECURSES
+#endif // else defined(DigitalSetByRuns_RECURSES)
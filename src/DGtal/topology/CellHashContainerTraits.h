@@ -0,0 +1,136 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CellHashContainerTraits.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module CellHashContainerTraits.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CellHashContainerTraits_RECURSES)
+#error Recursive header files inclusion detected in CellHashContainerTraits.h
+#else // defined(CellHashContainerTraits_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CellHashContainerTraits_RECURSES
+
+#if !defined CellHashContainerTraits_h
+/** Prevents repeated inclusion of headers. */
+#define CellHashContainerTraits_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CellHashContainerTraits
+  /**
+     Description of template class 'CellHashContainerTraits' <p>
+     \brief Aim: the traits classes giving the unordered (usually
+     hash-based) cell sets and maps of a cellular grid space.
+
+     The containers are not part of the concept
+     CCellularGridSpaceND. By default, they are the ordered sets and
+     maps of the space (CellSet, SCellSet, SurfelSet, CellMap,
+     SCellMap, SurfelMap). The traits are specialized for
+     KhalimskySpaceND, whose hash-based containers (CellHashSet,
+     SurfelHashMap...) give O(1) expected queries. Other models of
+     CCellularGridSpaceND with a hash function for their cells may
+     specialize them too.
+
+     @code
+     typedef CellHashContainerTraits<KSpace> HashTraits;
+     typename HashTraits::template SurfelHashMap<Number>::Type index;
+     @endcode
+
+     @tparam TKSpace any model of CCellularGridSpaceND.
+   */
+  template <typename TKSpace>
+  struct CellHashContainerTraits
+  {
+    // ----------------------- Specific traits ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    /// Set of Cell(s), without required order.
+    typedef typename KSpace::CellSet CellHashSet;
+    /// Set of SCell(s), without required order.
+    typedef typename KSpace::SCellSet SCellHashSet;
+    /// Set of surfels, without required order.
+    typedef typename KSpace::SurfelSet SurfelHashSet;
+    /// Template rebinding for defining the type that is a mapping
+    /// Cell -> Value, without required order.
+    template <typename Value> struct CellHashMap {
+      typedef typename KSpace::template CellMap<Value>::Type Type;
+    };
+    /// Template rebinding for defining the type that is a mapping
+    /// SCell -> Value, without required order.
+    template <typename Value> struct SCellHashMap {
+      typedef typename KSpace::template SCellMap<Value>::Type Type;
+    };
+    /// Template rebinding for defining the type that is a mapping
+    /// surfel -> Value, without required order.
+    template <typename Value> struct SurfelHashMap {
+      typedef typename KSpace::template SurfelMap<Value>::Type Type;
+    };
+  }; // end of class CellHashContainerTraits
+
+  /**
+     \brief Aim: Specialization of the traits classes for the hash-based
+     cell containers of KhalimskySpaceND.
+  */
+  template <Dimension dim, typename TInteger>
+  struct CellHashContainerTraits< KhalimskySpaceND<dim, TInteger> >
+  {
+    // ----------------------- Specific traits ------------------------------
+  public:
+    typedef KhalimskySpaceND<dim, TInteger> KSpace;
+    typedef typename KSpace::CellHashSet CellHashSet;
+    typedef typename KSpace::SCellHashSet SCellHashSet;
+    typedef typename KSpace::SurfelHashSet SurfelHashSet;
+    template <typename Value> struct CellHashMap {
+      typedef typename KSpace::template CellHashMap<Value>::Type Type;
+    };
+    template <typename Value> struct SCellHashMap {
+      typedef typename KSpace::template SCellHashMap<Value>::Type Type;
+    };
+    template <typename Value> struct SurfelHashMap {
+      typedef typename KSpace::template SurfelHashMap<Value>::Type Type;
+    };
+  };
+
+} // namespace DGtal
+
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CellHashContainerTraits_h
+
+#undef CellHashContainerTraits_RECURSES
+#endif // else defined(CellHashContainerTraits_RECURSES)
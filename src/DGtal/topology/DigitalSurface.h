@@ -54,6 +54,7 @@
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
 #include "DGtal/topology/CDigitalSurfaceTracker.h"
 #include "DGtal/topology/UmbrellaComputer.h"
+#include "DGtal/topology/CellHashContainerTraits.h"
 //////////////////////////////////////////////////////////////////////////////
 namespace boost
 {
@@ -0,0 +1,292 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HomotopicThinning.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module HomotopicThinning.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HomotopicThinning_RECURSES)
+#error Recursive header files inclusion detected in HomotopicThinning.h
+#else // defined(HomotopicThinning_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HomotopicThinning_RECURSES
+
+#if !defined HomotopicThinning_h
+/** Prevents repeated inclusion of headers. */
+#define HomotopicThinning_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/topology/MetricAdjacency.h"
+#include "DGtal/topology/Object.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class HomotopicThinning
+  /**
+   * Description of template class 'HomotopicThinning' <p> \brief Aim:
+   * Removes simple points of a digital object until no removable
+   * simple point remains, so that the object is thinned without
+   * changing its topology.
+   *
+   * The object is modified in place (its point set is eroded). Only
+   * border points (points lambda-adjacent to the background) are
+   * candidates, and a point is reconsidered only when one of its
+   * neighbors has been removed. Fixed (or anchor) points given by a
+   * point predicate are never removed, which allows to preserve end
+   * points, medial axis points, etc.
+   *
+   * Two strategies are provided:
+   *
+   * - \ref thin processes candidates through a priority queue,
+   *   smallest priority first. The priority is given by any functor
+   *   (a distance map for instance, giving a distance-ordered
+   *   thinning). By default, points are processed in lexicographic
+   *   order.
+   *
+   * - \ref thinBySubfields processes candidates in parallel. The
+   *   grid is split into the \f$2^d\f$ subfields of points with same
+   *   coordinate parities. No point of a subfield lies in the
+   *   \f$3^d\f$ neighborhood of another point of the same subfield,
+   *   so the simple points of one subfield may be detected
+   *   concurrently (with OpenMP if available) and removed together.
+   *
+   * Simplicity is tested with Object::isSimple, so giving a
+   * SimplicityTable to the object (Object::setTable) speeds up both
+   * strategies considerably.
+   *
+   @code
+   Z3i::Object26_6 shape( Z3i::dt26_6, shape_set );
+   shape.setTable( table );
+   HomotopicThinning< Z3i::Object26_6 > thinning( shape );
+   thinning.thinBySubfields( fixed_points );
+   // shape.pointSet() is now the thinned set.
+   @endcode
+   *
+   * @tparam TObject any Object type.
+   *
+   * @see testHomotopicThinning.cpp
+   */
+  template <typename TObject>
+  class HomotopicThinning
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TObject Object;
+    typedef typename Object::DigitalSet DigitalSet;
+    typedef typename Object::Point Point;
+    typedef typename Object::Size Size;
+    typedef typename Object::Space Space;
+    typedef typename Object::Domain Domain;
+    typedef typename Object::DigitalTopology::BackgroundAdjacency BackgroundAdjacency;
+    /// The adjacency of points whose simplicity may change when a point is removed.
+    typedef MetricAdjacency<Space, Space::dimension> AlphaAdjacency;
+    /// Default predicate: no point is fixed.
+    typedef functors::FalsePointPredicate<Point> NoFixedPoint;
+
+    /**
+     * Default priority: points are processed in lexicographic order.
+     */
+    struct LexicographicPriority
+    {
+      typedef Point Value;
+      const Point & operator()( const Point & p ) const { return p; }
+    };
+
+    /**
+     * Constructor.
+     * @param anObject the object to thin (modified in place).
+     */
+    HomotopicThinning( Alias<Object> anObject );
+
+    /**
+     * Destructor.
+     */
+    ~HomotopicThinning();
+
+    /**
+     * @return the thinned object.
+     */
+    Object & object();
+
+    /**
+     * @param p any point of the object.
+     * @return 'true' iff \a p is lambda-adjacent to some point of the background.
+     */
+    bool isBorder( const Point & p ) const;
+
+    // ----------------------- Thinning services ------------------------------
+  public:
+
+    /**
+     * Priority-queue based thinning.
+     *
+     * @tparam TFixedPredicate a model of concepts::CPointPredicate.
+     * @tparam TPriorityFunctor a functor Point -> Value, where Value
+     * (the type TPriorityFunctor::Value) is LessThanComparable.
+     *
+     * @param fixed the points that must not be removed.
+     * @param priority the priority of points (smallest first).
+     * @return the number of removed points.
+     */
+    template <typename TFixedPredicate, typename TPriorityFunctor>
+    Size thin( const TFixedPredicate & fixed, const TPriorityFunctor & priority );
+
+    /**
+     * Priority-queue based thinning in lexicographic order.
+     *
+     * @tparam TFixedPredicate a model of concepts::CPointPredicate.
+     * @param fixed the points that must not be removed.
+     * @return the number of removed points.
+     */
+    template <typename TFixedPredicate>
+    Size thin( const TFixedPredicate & fixed );
+
+    /**
+     * Priority-queue based thinning in lexicographic order, without
+     * fixed points.
+     * @return the number of removed points.
+     */
+    Size thin();
+
+    /**
+     * Parallel thinning by subfields.
+     *
+     * @tparam TFixedPredicate a model of concepts::CPointPredicate.
+     * @param fixed the points that must not be removed.
+     * @return the number of removed points.
+     */
+    template <typename TFixedPredicate>
+    Size thinBySubfields( const TFixedPredicate & fixed );
+
+    /**
+     * Parallel thinning by subfields, without fixed points.
+     * @return the number of removed points.
+     */
+    Size thinBySubfields();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// A pointer to the object being thinned.
+    Object* myObject;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    HomotopicThinning();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    HomotopicThinning ( const HomotopicThinning & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    HomotopicThinning & operator= ( const HomotopicThinning & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p any point.
+     * @return the index of the subfield of \a p (coordinate parities).
+     */
+    unsigned int subfield( const Point & p ) const;
+
+    /**
+     * Appends the border points of the object that are not fixed.
+     *
+     * @tparam TFixedPredicate a model of concepts::CPointPredicate.
+     * @param fixed the points that must not be removed.
+     * @param candidates (modified) the output vector.
+     */
+    template <typename TFixedPredicate>
+    void getCandidates( const TFixedPredicate & fixed,
+                        std::vector<Point> & candidates ) const;
+
+  }; // end of class HomotopicThinning
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'HomotopicThinning'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'HomotopicThinning' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TObject>
+  std::ostream&
+  operator<< ( std::ostream & out, const HomotopicThinning<TObject> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/HomotopicThinning.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HomotopicThinning_h
+
+#undef HomotopicThinning_RECURSES
+#endif // else defined(HomotopicThinning_RECURSES)
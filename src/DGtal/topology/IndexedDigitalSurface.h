@@ -0,0 +1,463 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IndexedDigitalSurface.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module IndexedDigitalSurface.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IndexedDigitalSurface_RECURSES)
+#error Recursive header files inclusion detected in IndexedDigitalSurface.h
+#else // defined(IndexedDigitalSurface_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IndexedDigitalSurface_RECURSES
+
+#if !defined IndexedDigitalSurface_h
+/** Prevents repeated inclusion of headers. */
+#define IndexedDigitalSurface_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <boost/unordered_set.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/CellHashContainerTraits.h"
+#include "DGtal/graph/STLVectorToVertexMapAdapter.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedDigitalSurface
+  /**
+  Description of template class 'IndexedDigitalSurface' <p> \brief
+  Aim: A frozen copy of a digital surface (see DigitalSurface) whose
+  surfels are numbered 0, 1, ..., n-1 and whose adjacencies and faces
+  are computed once and stored in compressed arrays.
+
+  The vertices of this graph are the numbers of the surfels, in the
+  order of the container of the digital surface. The out arcs of a
+  vertex v are numbered consecutively, from beginArc( v ) to endArc( v )
+  (excluded), in the order of DigitalSurface::outArcs, so that
+  neighbors are written in the same order as
+  DigitalSurface::writeNeighbors. Faces (umbrellas) are numbered in
+  the order of DigitalSurface::allFaces.
+
+  Hence degree, neighbors, head, tail and opposite arcs are O(1)
+  array accesses, without any tracker or surfel adjacency. Values
+  associated to surfels may be stored in arrays indexed by vertices
+  (see VertexMap and STLVectorToVertexMapAdapter), and estimators may
+  be evaluated on the range surfels().
+
+  IndexedDigitalSurface is a model of CUndirectedSimpleGraph. The
+  boost graph interface is given in
+  IndexedDigitalSurfaceBoostGraphInterface.h.
+
+  @code
+  typedef IndexedDigitalSurface<MyContainer> IndexedSurface;
+  IndexedSurface isurface( digSurf ); // digSurf is a DigitalSurface<MyContainer>
+  BreadthFirstVisitor<IndexedSurface> visitor( isurface, isurface.vertex( bel ) );
+  @endcode
+
+  @tparam TDigitalSurfaceContainer any model of
+  CDigitalSurfaceContainer.
+
+  @see DigitalSurface
+   */
+  template <typename TDigitalSurfaceContainer>
+  class IndexedDigitalSurface
+  {
+  public:
+    typedef TDigitalSurfaceContainer DigitalSurfaceContainer;
+    BOOST_CONCEPT_ASSERT(( concepts::CDigitalSurfaceContainer<DigitalSurfaceContainer> ));
+
+    // ----------------------- boost graph tags ------------------------------
+  public:
+    /// the graph is undirected.
+    typedef boost::undirected_tag directed_category;
+    /// the graph satisfies AdjacencyListGraph and VertexListGraph concepts.
+    typedef boost::DigitalSurface_graph_traversal_category traversal_category;
+    /// the graph does not allow parallel edges.
+    typedef boost::disallow_parallel_edge_tag edge_parallel_category;
+
+    // ----------------------- types ------------------------------
+  public:
+    typedef IndexedDigitalSurface<DigitalSurfaceContainer> Self;
+    typedef DigitalSurface<DigitalSurfaceContainer> Surface;
+    typedef typename DigitalSurfaceContainer::KSpace KSpace;
+    typedef typename DigitalSurfaceContainer::Cell Cell;
+    typedef typename DigitalSurfaceContainer::SCell SCell;
+    typedef typename DigitalSurfaceContainer::Surfel Surfel;
+    typedef typename KSpace::Point Point;
+
+    // ----------------------- UndirectedSimpleGraph --------------------------
+  public:
+    /// Defines how to represent a size (unsigned integral type).
+    typedef typename KSpace::Size Size;
+    /// A vertex is the number of a surfel.
+    typedef Size Vertex;
+    /// An arc is a number, the out arcs of a vertex being consecutive.
+    typedef Size Arc;
+    /// A face is a number.
+    typedef Size Face;
+    /// Iterator on the vertices 0, 1, ..., n-1.
+    typedef boost::counting_iterator<Vertex> ConstIterator;
+    /// Iterator on the neighbors of a vertex or on the vertices of a face.
+    typedef typename std::vector<Vertex>::const_iterator VertexConstIterator;
+    /// Iterator on the faces around a vertex.
+    typedef typename std::vector<Face>::const_iterator FaceConstIterator;
+    /// Defines how to represent a set of vertex.
+    typedef boost::unordered_set<Vertex> VertexSet;
+    /// Template rebinding for defining the type that is a mapping
+    /// Vertex -> Value, an array indexed by vertices.
+    template <typename Value> struct VertexMap {
+      typedef STLVectorToVertexMapAdapter< std::vector<Value>, Vertex > Type;
+    };
+    /**
+       An edge is a unordered pair of vertices, the smallest vertex
+       being stored before the greatest vertex (as in DigitalSurface).
+    */
+    struct Edge {
+      /// The two vertices.
+      Vertex vertices[ 2 ];
+      /**
+          Constructor from vertices.
+          @param v1 the first vertex.
+          @param v2 the second vertex.
+      */
+      Edge( const Vertex & v1, const Vertex & v2 )
+      {
+        vertices[ 0 ] = std::min( v1, v2 );
+        vertices[ 1 ] = std::max( v1, v2 );
+      }
+      bool operator==( const Edge & other ) const
+      {
+        return ( vertices[ 0 ] == other.vertices[ 0 ] )
+          && ( vertices[ 1 ] == other.vertices[ 1 ] );
+      }
+      bool operator<( const Edge & other ) const
+      {
+        return ( vertices[ 0 ] < other.vertices[ 0 ] )
+          || ( ( vertices[ 0 ] == other.vertices[ 0 ] )
+               && ( vertices[ 1 ] < other.vertices[ 1 ] ) );
+      }
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~IndexedDigitalSurface();
+
+    /**
+       Constructor. Numbers the surfels of \a surface, and computes
+       all its arcs and faces.
+       @param surface any digital surface.
+    */
+    IndexedDigitalSurface( const Surface & surface );
+
+    // ----------------------- Services --------------------------------------
+  public:
+
+    /// @return the cellular grid space of the surfels.
+    const KSpace & space() const;
+
+    /**
+       @param v any vertex.
+       @return the surfel numbered \a v.
+    */
+    const Surfel & surfel( const Vertex v ) const;
+
+    /**
+       @param s any surfel of the surface.
+       @return its number.
+       @pre isInside( s )
+    */
+    Vertex vertex( const Surfel & s ) const;
+
+    /**
+       @param s any surfel.
+       @return 'true' iff \a s is a surfel of the surface.
+    */
+    bool isInside( const Surfel & s ) const;
+
+    /// @return the surfels, the v-th one being numbered v.
+    const std::vector<Surfel> & surfels() const;
+
+    // ----------------- UndirectedSimpleGraph realization --------------------
+  public:
+
+    /// @return an iterator on the first vertex (0).
+    ConstIterator begin() const;
+
+    /// @return an iterator after the last vertex (n).
+    ConstIterator end() const;
+
+    /// @return the number of vertices of the graph.
+    Size size() const;
+
+    /**
+       @param v any vertex of this graph
+       @return the number of neighbors of this vertex.
+    */
+    Size degree( const Vertex & v ) const;
+
+    /**
+       @return 2*(K::dimension-1)
+    */
+    Size bestCapacity() const;
+
+    /**
+       Writes the neighbors of [v] in the output iterator [it], in the
+       order of its out arcs.
+
+       @tparam OutputIterator the type for the output iterator
+       (e.g. back_insert_iterator<std::vector<Vertex> >).
+
+       @param[in,out] it any output iterator on Vertex.
+       @param[in] v any vertex of this graph
+    */
+    template <typename OutputIterator>
+    void writeNeighbors( OutputIterator & it,
+                         const Vertex & v ) const;
+
+    /**
+       Writes the neighbors of [v], verifying the predicate [pred] in
+       the output iterator [it], in the order of its out arcs.
+
+       @tparam OutputIterator the type for the output iterator
+       (e.g. back_insert_iterator<std::vector<Vertex> >).
+
+       @tparam VertexPredicate any type of predicate taking a Vertex as input.
+
+       @param[in,out] it any output iterator on Vertex.
+       @param[in] v any vertex of this graph
+       @param[in] pred the predicate for selecting neighbors.
+    */
+    template <typename OutputIterator, typename VertexPredicate>
+    void writeNeighbors( OutputIterator & it,
+                         const Vertex & v,
+                         const VertexPredicate & pred ) const;
+
+    /**
+       @param v any vertex of this graph
+       @return an iterator on the first neighbor of \a v.
+    */
+    VertexConstIterator beginNeighbors( const Vertex & v ) const;
+
+    /**
+       @param v any vertex of this graph
+       @return an iterator after the last neighbor of \a v.
+    */
+    VertexConstIterator endNeighbors( const Vertex & v ) const;
+
+    // ----------------------- CombinatorialSurface --------------------------
+  public:
+
+    /// @return the number of arcs (twice the number of edges).
+    Size nbArcs() const;
+
+    /**
+       @param v any vertex.
+       @return the first out arc of \a v.
+    */
+    Arc beginArc( const Vertex & v ) const;
+
+    /**
+       @param v any vertex.
+       @return the arc after the last out arc of \a v.
+    */
+    Arc endArc( const Vertex & v ) const;
+
+    /**
+       @param a any arc (s,t)
+       @return the vertex t
+    */
+    Vertex head( const Arc & a ) const;
+
+    /**
+       @param a any arc (s,t)
+       @return the vertex s
+    */
+    Vertex tail( const Arc & a ) const;
+
+    /**
+       @param a any arc (s,t)
+       @return the arc (t,s)
+    */
+    Arc opposite( const Arc & a ) const;
+
+    /**
+       @param t the vertex at the tail of the arc.
+       @param h the vertex at the head of the arc.
+       @return the arc (t,h) or nbArcs() if \a t and \a h are not adjacent.
+    */
+    Arc arc( const Vertex & t, const Vertex & h ) const;
+
+    /**
+       @param a any arc.
+       @return the corresponding arc of the digital surface.
+    */
+    typename Surface::Arc surfaceArc( const Arc & a ) const;
+
+    /**
+       NB: there may be two arcs with the same separator.
+       @param a any arc.
+       @return the n-2-cell between the two surfels forming the arc.
+    */
+    SCell separator( const Arc & a ) const;
+
+    /// @return the number of faces, open or closed.
+    Size nbFaces() const;
+
+    /**
+       @param f any face.
+       @return 'true' iff the face is closed.
+    */
+    bool isClosed( const Face & f ) const;
+
+    /**
+       The vertices of a face are ordered as in
+       DigitalSurface::verticesAroundFace.
+       @param f any face.
+       @return an iterator on the first vertex of \a f.
+    */
+    VertexConstIterator beginVertices( const Face & f ) const;
+
+    /**
+       @param f any face.
+       @return an iterator after the last vertex of \a f.
+    */
+    VertexConstIterator endVertices( const Face & f ) const;
+
+    /**
+       @param v any vertex.
+       @return an iterator on the first face containing \a v.
+    */
+    FaceConstIterator beginFaces( const Vertex & v ) const;
+
+    /**
+       @param v any vertex.
+       @return an iterator after the last face containing \a v.
+    */
+    FaceConstIterator endFaces( const Vertex & v ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+       Writes/Displays the object on an output stream in OFF file
+       format, as DigitalSurface::exportSurfaceAs3DOFF.
+
+       @param out the output stream where the object is written.
+     */
+    void exportSurfaceAs3DOFF ( std::ostream & out ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The cellular grid space.
+    KSpace mySpace;
+    /// The surfels, the v-th one being numbered v.
+    std::vector<Surfel> mySurfels;
+    /// The number of each surfel.
+    typename CellHashContainerTraits<KSpace>::template SurfelHashMap<Vertex>::Type myVertices;
+    /// The first out arc of each vertex, then the number of arcs.
+    std::vector<Arc> myArcOffsets;
+    /// The tail of each arc.
+    std::vector<Vertex> myTails;
+    /// The head of each arc.
+    std::vector<Vertex> myHeads;
+    /// The opposite of each arc.
+    std::vector<Arc> myOpposites;
+    /// The direction and orientation (2*k+epsilon) of each arc.
+    std::vector<DGtal::uint8_t> myArcDirections;
+    /// The first vertex of each face in myFaceVertices, then its size.
+    std::vector<Size> myFaceOffsets;
+    /// The vertices of the faces.
+    std::vector<Vertex> myFaceVertices;
+    /// Tells if each face is closed.
+    std::vector<bool> myClosedFaces;
+    /// The first face of each vertex in myVertexFaces, then its size.
+    std::vector<Size> myVertexFaceOffsets;
+    /// The faces containing each vertex.
+    std::vector<Face> myVertexFaces;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    IndexedDigitalSurface();
+
+  }; // end of class IndexedDigitalSurface
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'IndexedDigitalSurface'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'IndexedDigitalSurface' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurfaceContainer>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const IndexedDigitalSurface<TDigitalSurfaceContainer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/IndexedDigitalSurface.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IndexedDigitalSurface_h
+
+#undef IndexedDigitalSurface_RECURSES
+#endif // else defined(IndexedDigitalSurface_RECURSES)
@@ -0,0 +1,186 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file KhalimskyCellKey.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module KhalimskyCellKey.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(KhalimskyCellKey_RECURSES)
+#error Recursive header files inclusion detected in KhalimskyCellKey.h
+#else // defined(KhalimskyCellKey_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define KhalimskyCellKey_RECURSES
+
+#if !defined KhalimskyCellKey_h
+/** Prevents repeated inclusion of headers. */
+#define KhalimskyCellKey_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskyCellKey
+  /**
+     Description of template class 'KhalimskyCellKey' <p> \brief
+     Aim: Packs the cells of a bounded cellular grid space into 64-bit
+     integer keys, and unpacks them.
+
+     The Khalimsky coordinates of a cell, relative to the lower cell
+     of the space, are stored on \f$ \lceil \log_2(n_k) \rceil \f$
+     bits for an axis of \f$ n_k \f$ Khalimsky coordinates, the first
+     axis being in the least significant bits. The key of a signed
+     cell is the key of its unsigned cell shifted by one bit, the least
+     significant bit being its sign. Hence a 3D space of up to \f$
+     2^{20} \f$ pixels along each axis has 64-bit keys for its signed
+     cells.
+
+     Keys are one word instead of several coordinates and a sign, so
+     sets of keys are much smaller and faster to hash or compare than
+     sets of cells (see PackedSurfelSet).
+
+     @tparam TKSpace a model of CCellularGridSpaceND, e.g. KhalimskySpaceND.
+     @see PackedSurfelSet
+  */
+  template <typename TKSpace>
+  class KhalimskyCellKey
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Cell Cell;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::Integer Integer;
+    /// Type of keys.
+    typedef DGtal::uint64_t Key;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The object is not valid.
+     */
+    KhalimskyCellKey();
+
+    /**
+     * Constructor from a space.
+     * @param aKSpace any bounded space.
+     * @throw InputException if the keys of the signed cells of the
+     * space do not fit in 64 bits.
+     */
+    KhalimskyCellKey( const KSpace & aKSpace );
+
+    // ----------------------- Key services ------------------------------
+  public:
+
+    /**
+     * @param c any cell of the space.
+     * @return its key.
+     */
+    Key key( const Cell & c ) const;
+
+    /**
+     * @param c any signed cell of the space.
+     * @return its key.
+     */
+    Key key( const SCell & c ) const;
+
+    /**
+     * @param k the key of a cell.
+     * @return the cell.
+     */
+    Cell cell( const Key k ) const;
+
+    /**
+     * @param k the key of a signed cell.
+     * @return the signed cell.
+     */
+    SCell sCell( const Key k ) const;
+
+    /**
+     * @return the number of bits used by the keys of signed cells.
+     */
+    unsigned int nbBits() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object has been built from a space.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Khalimsky coordinates of the lower cell of the space.
+    Point myLower;
+    /// Position of the coordinates of each axis in the keys.
+    unsigned int myShifts[ KSpace::dimension ];
+    /// Masks of the coordinates of each axis (once shifted right).
+    Key myMasks[ KSpace::dimension ];
+    /// Number of bits of the keys of signed cells (0 if not valid).
+    unsigned int myNbBits;
+
+  }; // end of class KhalimskyCellKey
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'KhalimskyCellKey'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'KhalimskyCellKey' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const KhalimskyCellKey<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/KhalimskyCellKey.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined KhalimskyCellKey_h
+
+#undef KhalimskyCellKey_RECURSES
+#endif // else defined(KhalimskyCellKey_RECURSES)
@@ -43,6 +43,8 @@
 #include <iostream>
 #include <set>
 #include <map>
+#include <boost/unordered_set.hpp>
+#include <boost/unordered_map.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/PointVector.h"
@@ -138,6 +140,17 @@ namespace DGtal
   operator<<( std::ostream & out,
               const KhalimskyCell< dim, TInteger > & object );
 
+  /**
+     Hash function of cells, so that they can be stored in
+     boost::unordered_set or boost::unordered_map.
+     @param object any cell.
+     @return the hash value of its Khalimsky coordinates.
+  */
+  template < Dimension dim,
+             typename TInteger >
+  std::size_t
+  hash_value( const KhalimskyCell< dim, TInteger > & object );
+
   /**
      @brief Represents a signed cell in a cellular grid space by its
      Khalimsky coordinates and a boolean value.
@@ -224,6 +237,17 @@ namespace DGtal
   operator<<( std::ostream & out,
               const SignedKhalimskyCell< dim, TInteger > & object );
 
+  /**
+     Hash function of signed cells, so that they can be stored in
+     boost::unordered_set or boost::unordered_map.
+     @param object any signed cell.
+     @return the hash value of its Khalimsky coordinates and sign.
+  */
+  template < Dimension dim,
+             typename TInteger >
+  std::size_t
+  hash_value( const SignedKhalimskyCell< dim, TInteger > & object );
+
   /**
      @brief This class is useful for looping on all "interesting" coordinates of a
      cell. For instance, surfels in Z3 have two interesting coordinates (the
@@ -406,6 +430,29 @@ namespace DGtal
     template <typename Value> struct SurfelMap {
       typedef std::map<SCell,Value> Type;
     };
+    /// Hash-based set of Cell(s), with O(1) expected insertions and
+    /// queries but no order on the cells.
+    typedef boost::unordered_set<Cell> CellHashSet;
+    /// Hash-based set of SCell(s).
+    typedef boost::unordered_set<SCell> SCellHashSet;
+    /// Hash-based set of surfels (always signed cells). It may
+    /// replace SurfelSet in Surfaces::trackBoundary or SetOfSurfels.
+    typedef boost::unordered_set<SCell> SurfelHashSet;
+    /// Template rebinding for defining the type that is a hash-based
+    /// mapping Cell -> Value.
+    template <typename Value> struct CellHashMap {
+      typedef boost::unordered_map<Cell,Value> Type;
+    };
+    /// Template rebinding for defining the type that is a hash-based
+    /// mapping SCell -> Value.
+    template <typename Value> struct SCellHashMap {
+      typedef boost::unordered_map<SCell,Value> Type;
+    };
+    /// Template rebinding for defining the type that is a hash-based
+    /// mapping surfel -> Value.
+    template <typename Value> struct SurfelHashMap {
+      typedef boost::unordered_map<SCell,Value> Type;
+    };
     // ----------------------- Standard services ------------------------------
   public:
 
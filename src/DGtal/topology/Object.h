@@ -49,9 +49,11 @@
 #include "DGtal/base/Clone.h"
 #include "DGtal/base/Alias.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/topology/Topology.h"
+#include "DGtal/topology/SimplicityTable.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -111,6 +113,7 @@ namespace DGtal
       typedef Object<ReverseTopology, DigitalSet> ComplementObject;
       typedef Object<DigitalTopology, SmallSet> SmallObject;
       typedef Object<ReverseTopology, SmallSet> SmallComplementObject;
+      typedef DGtal::SimplicityTable<DigitalTopology> Table;
 
       // Required by CUndirectedSimpleLocalGraph
       typedef TDigitalSet VertexSet;
@@ -473,10 +476,29 @@ namespace DGtal
        * careful, such a definition is valid only for Jordan couples in
        * dimension 2 and 3.
        *
+       * If a simplicity table has been given with \ref setTable,
+       * the neighborhood of \a v is encoded and the answer is a
+       * single table lookup.
+       *
        * @return 'true' if this point is simple.
        */
       bool isSimple( const Point & v ) const;
 
+      /**
+       * Sets the precomputed simplicity table used by \ref isSimple.
+       * The table is shared, not copied, and must have been
+       * initialized (see SimplicityTable::init and
+       * SimplicityTable::load).
+       *
+       * @param aTable a simplicity table for the topology of this object.
+       */
+      void setTable( ConstAlias<Table> aTable );
+
+      /**
+       * @return 'true' if this object uses a precomputed simplicity table.
+       */
+      bool hasTable() const;
+
       // ----------------------- Interface --------------------------------------
     public:
 
@@ -511,6 +533,12 @@ namespace DGtal
        * Connectedness of this object. Either CONNECTED, DISCONNECTED, or UNKNOWN.
        */
       mutable Connectedness myConnectedness;
+
+      /**
+       * The (shared) simplicity table, or 0 if simplicity is computed
+       * with geodesic neighborhoods.
+       */
+      CountedConstPtrOrConstPtr<Table> myTable;
       
 
       // ------------------------- Hidden services ------------------------------
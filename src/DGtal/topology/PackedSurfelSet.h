@@ -0,0 +1,242 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedSurfelSet.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module PackedSurfelSet.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedSurfelSet_RECURSES)
+#error Recursive header files inclusion detected in PackedSurfelSet.h
+#else // defined(PackedSurfelSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedSurfelSet_RECURSES
+
+#if !defined PackedSurfelSet_h
+/** Prevents repeated inclusion of headers. */
+#define PackedSurfelSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <utility>
+#include <boost/unordered_set.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskyCellKey.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedSurfelSet
+  /**
+     Description of template class 'PackedSurfelSet' <p> \brief
+     Aim: A set of signed cells (e.g. surfels) stored as a set of
+     64-bit keys (see KhalimskyCellKey), with the interface of
+     std::set<SCell> used by Surfaces::trackBoundary, SetOfSurfels or
+     SurfelSetPredicate. It may thus replace KSpace::SurfelSet.
+
+     The set of keys is a template parameter:
+     - boost::unordered_set<Key> (default): O(1) expected insertions
+       and queries, the choice for tracking boundaries;
+     - SortedVectorSet<Key>: 8 bytes per cell, O(log n) queries,
+       filled by batches with insert( first, last ), the choice for
+       storing big boundaries.
+
+     Iterators visit the cells in the iteration order of the key set,
+     which is the order of the keys only for SortedVectorSet (hash
+     order for boost::unordered_set), and return cells by value.
+
+     @code
+     typedef PackedSurfelSet<Z3i::KSpace> SurfelSet;
+     SurfelSet boundary( K );
+     Surfaces<Z3i::KSpace>::trackBoundary( boundary, K, SAdj, set, bel );
+     SetOfSurfels<Z3i::KSpace, SurfelSet> surface( K, SAdj, boundary );
+     @endcode
+
+     @tparam TKSpace a model of CCellularGridSpaceND, e.g. KhalimskySpaceND.
+     @tparam TKeySet a set of DGtal::uint64_t with insert, find, count,
+     erase, begin and end.
+
+     @see KhalimskyCellKey, SortedVectorSet
+  */
+  template <typename TKSpace,
+            typename TKeySet = boost::unordered_set<DGtal::uint64_t> >
+  class PackedSurfelSet
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef TKeySet KeySet;
+    typedef KhalimskyCellKey<KSpace> CellKey;
+    typedef typename CellKey::Key Key;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KeySet::size_type Size;
+
+    /// Unpacks keys into signed cells.
+    struct Unpack {
+      typedef SCell result_type;
+      Unpack() {}
+      Unpack( const CellKey & aCellKey ) : myCellKey( aCellKey ) {}
+      SCell operator()( const Key k ) const { return myCellKey.sCell( k ); }
+      CellKey myCellKey;
+    };
+
+    // std::set-like types
+    typedef SCell key_type;
+    typedef SCell value_type;
+    typedef Size size_type;
+    typedef boost::transform_iterator< Unpack, typename KeySet::const_iterator,
+                                       SCell, SCell > const_iterator;
+    typedef const_iterator iterator;
+    typedef const_iterator ConstIterator;
+    typedef const_iterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The set is empty.
+     * @param aKSpace the space of the cells (its bounds only are used).
+     */
+    PackedSurfelSet( const KSpace & aKSpace );
+
+    // ----------------------- Set services ------------------------------
+  public:
+
+    /// @return the number of cells.
+    Size size() const;
+
+    /// @return 'true' iff the set is empty.
+    bool empty() const;
+
+    /// Removes all the cells.
+    void clear();
+
+    /**
+     * Inserts a cell.
+     * @param c any signed cell of the space.
+     * @return the iterator to c and 'true' if c has been inserted.
+     */
+    std::pair<iterator,bool> insert( const SCell & c );
+
+    /**
+     * Inserts a range of cells at once (their keys are computed
+     * first then inserted together).
+     * @tparam SCellInputIterator any input iterator on signed cells.
+     * @param first the first cell.
+     * @param last after the last cell.
+     */
+    template <typename SCellInputIterator>
+    void insert( SCellInputIterator first, SCellInputIterator last );
+
+    /**
+     * Removes a cell.
+     * @param c any signed cell of the space.
+     * @return the number of removed cells (0 or 1).
+     */
+    Size erase( const SCell & c );
+
+    /**
+     * @param c any signed cell of the space.
+     * @return an iterator to c, or end() if c is not in the set.
+     */
+    const_iterator find( const SCell & c ) const;
+
+    /**
+     * @param c any signed cell of the space.
+     * @return 1 if c is in the set, 0 otherwise.
+     */
+    Size count( const SCell & c ) const;
+
+    /// @return the begin iterator.
+    const_iterator begin() const;
+
+    /// @return the end iterator.
+    const_iterator end() const;
+
+    /// @return the set of keys.
+    const KeySet & keys() const;
+
+    /// @return the packing of cells into keys.
+    const CellKey & cellKey() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The packing of cells into keys.
+    CellKey myCellKey;
+    /// The keys of the cells.
+    KeySet myKeys;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the iterator on cells corresponding to \a it.
+    const_iterator wrap( typename KeySet::const_iterator it ) const;
+
+  }; // end of class PackedSurfelSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedSurfelSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedSurfelSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TKeySet>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedSurfelSet<TKSpace,TKeySet> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/PackedSurfelSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedSurfelSet_h
+
+#undef PackedSurfelSet_RECURSES
+#endif // else defined(PackedSurfelSet_RECURSES)
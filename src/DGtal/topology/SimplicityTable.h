@@ -0,0 +1,325 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SimplicityTable.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module SimplicityTable.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SimplicityTable_RECURSES)
+#error Recursive header files inclusion detected in SimplicityTable.h
+#else // defined(SimplicityTable_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SimplicityTable_RECURSES
+
+#if !defined SimplicityTable_h
+/** Prevents repeated inclusion of headers. */
+#define SimplicityTable_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/dynamic_bitset.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/topology/DigitalTopologyTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SimplicityTable
+  /**
+   * Description of template class 'SimplicityTable' <p> \brief Aim:
+   * Precomputed table telling whether the central point of a
+   * \f$3^d\f$ neighborhood is simple, for a given digital topology
+   * \f$(\kappa,\lambda)\f$ in dimension 2 or 3.
+   *
+   * A configuration encodes the occupancy of the \f$3^d-1\f$ points
+   * around the central point: bit \a i is set iff the \a i-th
+   * neighbor (in the lexicographic order of the domain \f$[-1,1]^d\f$,
+   * the center being skipped) belongs to the object. This is the
+   * encoding used by the examples generateSimplicityTables2D.cpp and
+   * generateSimplicityTables3D.cpp.
+   *
+   * The simplicity of a configuration is evaluated with the same
+   * geodesic neighborhood definition as Object::isSimple (see
+   * DigitalTopologyTraits), but with bitwise operations on the
+   * neighborhood masks instead of building small objects. The whole
+   * table (\f$2^8\f$ bits in 2D, \f$2^{26}\f$ bits in 3D) may be
+   * computed once with \ref init, or restored with \ref load from a
+   * file previously written with \ref save. It is then shared by
+   * objects through Object::setTable, and a simplicity test boils
+   * down to one lookup.
+   *
+   @code
+   typedef SimplicityTable< Z3i::DT26_6 > Table;
+   Table table( Z3i::dt26_6 );
+   table.init(); // or table.load( some_input_stream );
+   Z3i::Object26_6 shape( Z3i::dt26_6, shape_set );
+   shape.setTable( table );
+   bool b = shape.isSimple( p ); // one table lookup
+   @endcode
+   *
+   * @tparam TDigitalTopology any realization of DigitalTopology
+   * whose adjacencies are MetricAdjacency, in dimension 2 or 3.
+   *
+   * @see testSimplicityTable.cpp
+   * @see testSimplicityTable-benchmark.cpp
+   */
+  template <typename TDigitalTopology>
+  class SimplicityTable
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TDigitalTopology DigitalTopology;
+    typedef typename DigitalTopology::ForegroundAdjacency ForegroundAdjacency;
+    typedef typename DigitalTopology::BackgroundAdjacency BackgroundAdjacency;
+    typedef typename ForegroundAdjacency::Space Space;
+    typedef typename Space::Point Point;
+    /// Type used to encode the occupancy of the neighborhood of a point.
+    typedef DGtal::uint32_t Configuration;
+
+    static const Dimension dimension = Space::dimension;
+
+    /**
+     * Constructor. Computes the neighborhood masks but not the
+     * table itself (see \ref init and \ref load).
+     *
+     * @param aTopology the digital topology \f$(\kappa,\lambda)\f$.
+     */
+    SimplicityTable( Clone<DigitalTopology> aTopology );
+
+    /**
+     * Destructor.
+     */
+    ~SimplicityTable();
+
+    /**
+     * Computes the whole table by evaluating every configuration.
+     */
+    void init();
+
+    /**
+     * @return 'true' if the table has been computed or loaded.
+     */
+    bool isInitialized() const;
+
+    /**
+     * @return the digital topology of this table.
+     */
+    const DigitalTopology & topology() const;
+
+    /**
+     * @return the number of points around the central point, i.e. \f$3^d-1\f$.
+     */
+    unsigned int nbNeighbors() const;
+
+    /**
+     * @return the number of configurations, i.e. \f$2^{3^d-1}\f$.
+     */
+    Configuration nbConfigurations() const;
+
+    // ----------------------- Simplicity services ----------------------------
+  public:
+
+    /**
+     * Table lookup. The table must be initialized.
+     *
+     * @param cfg any configuration.
+     * @return 'true' iff the central point is simple in this configuration.
+     */
+    bool operator()( Configuration cfg ) const;
+
+    /**
+     * Evaluates the simplicity of the central point in the given
+     * configuration without using the table.
+     *
+     * @param cfg any configuration.
+     * @return 'true' iff the central point is simple in this configuration.
+     */
+    bool isSimpleConfiguration( Configuration cfg ) const;
+
+    /**
+     * Encodes the neighborhood of point \a p in the set \a X.
+     *
+     * @tparam TPointPredicate any model of concepts::CPointPredicate
+     * (a digital set for instance).
+     *
+     * @param X the characteristic function of the object.
+     * @param p any point.
+     * @return the configuration of the neighborhood of \a p.
+     */
+    template <typename TPointPredicate>
+    Configuration configuration( const TPointPredicate & X,
+                                 const Point & p ) const;
+
+    /**
+     * @tparam TPointPredicate any model of concepts::CPointPredicate
+     * (a digital set for instance).
+     *
+     * @param X the characteristic function of the object.
+     * @param p any point.
+     * @return 'true' iff \a p is simple for \a X (table lookup).
+     */
+    template <typename TPointPredicate>
+    bool isSimple( const TPointPredicate & X, const Point & p ) const;
+
+    // ----------------------- Input / Output ---------------------------------
+  public:
+
+    /**
+     * Writes the table in binary form.
+     * @param out the output stream.
+     */
+    void save( std::ostream & out ) const;
+
+    /**
+     * Reads a table previously written by \ref save.
+     * @param in the input stream.
+     * @return 'true' if the table was successfully read.
+     */
+    bool load( std::istream & in );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The digital topology of the table.
+    DigitalTopology myTopology;
+    /// The points of \f$[-1,1]^d\f$ except the origin, in lexicographic order.
+    std::vector<Point> myOffsets;
+    /// For each point of \f$[-1,1]^d\f$, the mask of its kappa-neighbors.
+    std::vector<Configuration> myKappaMasks;
+    /// For each point of \f$[-1,1]^d\f$, the mask of its lambda-neighbors.
+    std::vector<Configuration> myLambdaMasks;
+    /// The index of the central point in \f$[-1,1]^d\f$.
+    unsigned int myCenter;
+    /// The order of the geodesic neighborhood in the object.
+    unsigned int myKappaOrder;
+    /// The order of the geodesic neighborhood in the complement.
+    unsigned int myLambdaOrder;
+    /// The table (one bit per configuration).
+    boost::dynamic_bitset<> myTable;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    SimplicityTable();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    SimplicityTable ( const SimplicityTable & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    SimplicityTable & operator= ( const SimplicityTable & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param masks the adjacency masks.
+     * @param X a subset of \f$[-1,1]^d\f$ (one bit per point).
+     * @param k the order of the neighborhood.
+     * @return the geodesic neighborhood of order \a k of the center in \a X.
+     */
+    Configuration geodesicNeighborhood( const std::vector<Configuration> & masks,
+                                        Configuration X, unsigned int k ) const;
+
+    /**
+     * @param masks the adjacency masks.
+     * @param S a subset of \f$[-1,1]^d\f$ (one bit per point).
+     * @return 'true' iff \a S is connected for the adjacency given by \a masks.
+     */
+    bool isConnected( const std::vector<Configuration> & masks,
+                      Configuration S ) const;
+
+    /**
+     * @param masks the adjacency masks.
+     * @param S a subset of \f$[-1,1]^d\f$ (one bit per point).
+     * @return the union of the neighborhoods of the points of \a S.
+     */
+    Configuration neighbors( const std::vector<Configuration> & masks,
+                             Configuration S ) const;
+
+  }; // end of class SimplicityTable
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SimplicityTable'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SimplicityTable' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalTopology>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const SimplicityTable<TDigitalTopology> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SimplicityTable.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SimplicityTable_h
+
+#undef SimplicityTable_RECURSES
+#endif // else defined(SimplicityTable_RECURSES)
@@ -45,6 +45,7 @@
 #include "DGtal/base/Exceptions.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/KhalimskyCellKey.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -85,6 +86,9 @@ namespace DGtal
     typedef typename KSpace::Cell Cell;
     typedef typename KSpace::SCell SCell;
     typedef typename KSpace::DirIterator DirIterator;
+    typedef KhalimskyCellKey<KSpace> CellKey;
+    typedef typename CellKey::Key Key;
+    typedef std::size_t Size;
 
     // ----------------------- Static services ------------------------------
   public:
@@ -158,7 +162,8 @@ namespace DGtal
        PointPredicate. The algorithms tracks surfels along the
        boundary of the shape.
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>,
+       KSpace::SurfelHashSet or PackedSurfelSet).
 
        @tparam PointPredicate a model of concepts::CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
@@ -199,7 +204,8 @@ namespace DGtal
        be fully inside the space. Follows the idea of Artzy, Frieder
        and Herman algorithm [Artzy:1981-cgip], but in nD.
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>,
+       KSpace::SurfelHashSet or PackedSurfelSet).
 
        @tparam PointPredicate a model of concepts::CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
@@ -237,7 +243,8 @@ namespace DGtal
        boundary component of a digital surface described by a
        SurfelPredicate. The algorithms tracks surfels along the surface.
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>,
+       KSpace::SurfelHashSet or PackedSurfelSet).
 
        @tparam SurfelPredicate a model of CSurfelPredicate describing
        whether a surfel belongs or not to the surface.
@@ -272,7 +279,8 @@ namespace DGtal
        surface. This is an optimized version of trackSurface, which is
        valid only when the tracked surface is closed.
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>,
+       KSpace::SurfelHashSet or PackedSurfelSet).
 
        @tparam SurfelPredicate a model of CSurfelPredicate describing
        whether a surfel belongs or not to the surface.
@@ -620,6 +628,60 @@ namespace DGtal
       const PointPredicate & pp,
       bool forceOrientCellExterior=false );
 
+    /**
+       Extracts all the connected boundaries of a digital shape in
+       parallel (with OpenMP if available). The bels are first
+       detected line by line in parallel, then grouped by a union-find
+       whose unions are computed in parallel on blocks of bels, and
+       finally output as packed cells (see KhalimskyCellKey), each
+       boundary being a contiguous range of the output array. The
+       i-th boundary is [ aSurfels[ anOffsets[ i ] ],
+       aSurfels[ anOffsets[ i+1 ] ] ).
+
+       The bels are those of sMakeBoundary in the bounds of \a
+       aKSpace, and two bels are in the same boundary whenever one is
+       tracked from the other by trackBoundary. Boundaries are
+       ordered by their smallest key, and the bels of a boundary by
+       increasing keys, so the result does not depend on the number of
+       threads.
+
+       @code
+       std::vector<Surfaces<KSpace>::Key> surfels;
+       std::vector<Surfaces<KSpace>::Size> offsets;
+       Surfaces<KSpace>::extractAllBoundaries( surfels, offsets, K, SAdj, image_pred );
+       Surfaces<KSpace>::CellKey cellKey( K );
+       SCell bel = cellKey.sCell( surfels[ offsets[ 1 ] ] ); // first bel of the 2nd boundary.
+       @endcode
+
+       @tparam PointPredicate a model of concepts::CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+       It is called concurrently.
+
+       @param aSurfels (modified) the keys of the bels of all the boundaries.
+
+       @param anOffsets (modified) the number of boundaries plus one
+       offsets in \a aSurfels.
+
+       @param aKSpace any space, whose signed cells have 64-bit keys
+       (otherwise InputException is thrown, see KhalimskyCellKey).
+
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @see extractAllConnectedSCell
+    */
+    template <typename PointPredicate>
+    static
+    void extractAllBoundaries
+    ( std::vector<Key> & aSurfels,
+      std::vector<Size> & anOffsets,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+      const PointPredicate & pp );
+
     
     
 
@@ -691,7 +753,8 @@ namespace DGtal
        boundary components of a digital shape described by the predicate
        [pp].
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>,
+       KSpace::SurfelHashSet or PackedSurfelSet).
        @tparam PointPredicate a model of concepts::CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
        and returning 'true' whenever the point belongs to the shape.
@@ -896,6 +959,24 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Root of an element in a union-find forest where each parent is
+     * not greater than its child (path halving).
+     * @param parents the parent of each element.
+     * @param i any element.
+     * @return the root of \a i.
+     */
+    static Size findRoot( std::vector<Size> & parents, Size i );
+
+    /**
+     * Merges the trees of two elements, the greatest root becoming a
+     * child of the smallest one.
+     * @param parents the parent of each element.
+     * @param i any element.
+     * @param j any element.
+     */
+    static void mergeRoots( std::vector<Size> & parents, Size i, Size j );
+
   }; // end of class Surfaces
 
 
@@ -0,0 +1,196 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIndexedEstimatorCache.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class IndexedEstimatorCache.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/surfaces/estimation/IndexedEstimatorCache.h"
+///
+/// Shape
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+
+ /// Digitization
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/ImplicitDigitalSurface.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+#include "DGtal/graph/DepthFirstVisitor.h"
+#include "DGtal/graph/GraphVisitorRange.h"
+
+/// Estimator
+#include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class IndexedEstimatorCache.
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * Caches integral invariant Gaussian curvatures, then saves and
+ * reloads them.
+ */
+bool testIndexedEstimatorCache(double h)
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef ImplicitBall<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef ImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef IndexedDigitalSurface< Boundary > MyIndexedSurface;
+  typedef DepthFirstVisitor< MyDigitalSurface > Visitor;
+  typedef GraphVisitorRange< Visitor > VisitorRange;
+
+  typedef functors::IIGaussianCurvature3DFunctor<Z3i::Space> MyIICurvatureFunctor;
+  typedef IntegralInvariantCovarianceEstimator< Z3i::KSpace, DigitalShape, MyIICurvatureFunctor > MyIICurvatureEstimator;
+
+  double re = 5.0;
+  double radius = 5.0;
+
+  trace.beginBlock( "Shape initialisation ..." );
+
+  ImplicitShape ishape( Z3i::RealPoint( 0, 0, 0 ), radius );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( Z3i::RealPoint( -10.0, -10.0, -10.0 ), Z3i::RealPoint( 10.0, 10.0, 10.0 ), h );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    return false;
+  }
+
+  Z3i::KSpace::Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary* boundary = new Boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+  MyIndexedSurface isurf( surf );
+  trace.info() << isurf << std::endl;
+
+  trace.endBlock();
+
+  trace.beginBlock( "Caching values ...");
+
+  MyIICurvatureFunctor curvatureFunctor;
+  curvatureFunctor.init( h, re );
+
+  MyIICurvatureEstimator curvatureEstimator( curvatureFunctor );
+  curvatureEstimator.attach( K, dshape );
+  curvatureEstimator.setParams( re/h );
+
+  typedef IndexedEstimatorCache<MyIICurvatureEstimator, MyIndexedSurface> GaussianCache;
+  BOOST_CONCEPT_ASSERT(( concepts::CSurfelLocalEstimator<GaussianCache> ));
+
+  // The range is single pass, it is given as is to the cache.
+  VisitorRange range( new Visitor( surf, *surf.begin() ));
+  GaussianCache cache( curvatureEstimator, isurf );
+  cache.init( h, range.begin(), range.end() );
+  trace.info() << cache << std::endl;
+  nbok += ( cache.size() == isurf.size() ) && cache.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "all surfels are cached" << std::endl;
+
+  double maxError = 0.0;
+  unsigned int nbErrors = 0;
+  for ( MyDigitalSurface::ConstIterator it = surf.begin(), itend = surf.end(); it != itend; ++it )
+    {
+      const MyIICurvatureEstimator::Quantity expected = curvatureEstimator.eval( it );
+      maxError = std::max( maxError, std::abs( cache.eval( it ) - expected ) );
+      if ( cache.value( isurf.vertex( *it ) ) != cache.eval( *it ) )
+        nbErrors++;
+    }
+  trace.info() << "max error=" << maxError << std::endl;
+  nbok += ( nbErrors == 0 ) && ( maxError < 1e-8 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "cache == eval" << std::endl;
+
+  // The II covariance functors and the digitizer are thread-safe.
+  GaussianCache parallelCache( curvatureEstimator, isurf );
+  parallelCache.initParallel( h, surf.begin(), surf.end() );
+  nbok += ( parallelCache.size() == cache.size() )
+    && ( parallelCache.values() == cache.values() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "initParallel == init" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "Saving and loading values ...");
+  std::stringstream buffer;
+  cache.save( buffer );
+  const std::string saved = buffer.str();
+  GaussianCache cache2( curvatureEstimator, isurf );
+  const bool loaded = cache2.load( buffer );
+  nbok += loaded && ( cache2.size() == cache.size() ) && ( cache2.h() == cache.h() )
+    && ( cache2.values() == cache.values() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "load( save( cache ) ) == cache" << std::endl;
+
+  std::stringstream truncated( saved.substr( 0, saved.size() / 2 ) );
+  GaussianCache cache3( curvatureEstimator, isurf );
+  nbok += ( ! cache3.load( truncated ) ) && ( ! cache3.isCached( 0 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "truncated stream is rejected" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class IndexedEstimatorCache" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testIndexedEstimatorCache( 0.8 ); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
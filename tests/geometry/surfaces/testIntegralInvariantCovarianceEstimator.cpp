@@ -118,6 +118,22 @@ bool testGaussianCurvature3d( double h, double delta )
 
   trace.endBlock();
 
+  trace.beginBlock( "Comparing parallel evaluation with sequential evaluation ...");
+
+  // evalParallel cuts the range into chunks (see WITH_OPENMP), it
+  // must give exactly the values of eval.
+  VisitorRange range2( new Visitor( surf, *surf.begin() ));
+  const std::vector< MyDigitalSurface::Surfel > surfels( range2.begin(), range2.end() );
+  std::vector< Value > parallelResults( surfels.size() );
+  curvatureEstimator.evalParallel( surfels.begin(), surfels.end(), parallelResults.begin() );
+  const bool isSame = ( parallelResults == results );
+  trace.info() << "same results=" << ( isSame ? "yes" : "no" ) << std::endl;
+
+  trace.endBlock();
+
+  if ( ! isSame )
+    return false;
+
   trace.beginBlock ( "Comparing results of integral invariant 3D Gaussian curvature ..." );
 
   double mean = 0.0;
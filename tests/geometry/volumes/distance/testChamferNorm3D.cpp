@@ -0,0 +1,243 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testChamferNorm3D.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class ChamferNorm3D.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/geometry/volumes/distance/CMetricSpace.h"
+#include "DGtal/geometry/volumes/distance/CPowerMetric.h"
+#include "DGtal/geometry/volumes/distance/ChamferNorm3D.h"
+#include "DGtal/geometry/volumes/distance/GeodesicDistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef experimental::ChamferNorm3D<Z3i::Space> Norm;
+
+/**
+ * Linear congruential generator, so that the random sites do not
+ * depend on the platform.
+ */
+struct Random
+{
+  Random() : state( 0 ) {}
+  int operator()( int n )
+  {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (int) ( ( state >> 33 ) % (DGtal::uint64_t) n );
+  }
+  DGtal::uint64_t state;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ChamferNorm3D.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Concepts and facets of the standard masks, and user-defined masks.
+ */
+bool testMasks()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock( "Chamfer masks" );
+
+  BOOST_CONCEPT_ASSERT(( concepts::CMetricSpace<Norm> ));
+  BOOST_CONCEPT_ASSERT(( concepts::CPowerMetric<Norm> ));
+
+  const Norm mask3 = Norm::mask3x3x3();
+  const Norm mask5 = Norm::mask5x5x5();
+  trace.info() << mask3 << std::endl << mask5 << std::endl;
+  nbok += ( mask3.isValid() && mask5.isValid() ) ? 1 : 0;
+  nb++;
+  nbok += ( mask3.size() == 7 ) && ( mask3.normals().size() == 3 )
+    && ( mask5.size() == 19 ) && ( mask5.normals().size() == 18 ) ? 1 : 0;
+  nb++;
+  nbok += ( mask3.rawDistance( Z3i::Point( 1, 2, 3 ), Z3i::Point( -2, 2, 5 ) ) == 11 )
+    && ( mask5.rawDistance( Z3i::Point( 0, 0, 0 ), Z3i::Point( 3, -1, 0 ) ) == 23 )
+    && ( std::abs( mask3( Z3i::Point( 0, 0, 0 ), Z3i::Point( 0, 4, 0 ) ) - 4.0 ) < 1e-9 )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "standard masks" << std::endl;
+
+  // A mask whose facet normals are not integers.
+  Norm::Directions dirs;
+  std::vector<Norm::RawValue> weights;
+  dirs.push_back( Z3i::Vector( 1, 0, 0 ) ); weights.push_back( 2 );
+  dirs.push_back( Z3i::Vector( 0, 1, 0 ) ); weights.push_back( 2 );
+  dirs.push_back( Z3i::Vector( 0, 0, 1 ) ); weights.push_back( 2 );
+  dirs.push_back( Z3i::Vector( 1, 1, 0 ) ); weights.push_back( 3 );
+  dirs.push_back( Z3i::Vector( 1, 0, 1 ) ); weights.push_back( 3 );
+  dirs.push_back( Z3i::Vector( 0, 1, 1 ) ); weights.push_back( 3 );
+  const Norm user( dirs, weights );
+  trace.info() << user << std::endl;
+  nbok += user.isValid() && ( user.rawScale() > 1 ) ? 1 : 0;
+  nb++;
+  nbok += ( std::abs( user( Z3i::Point( 0, 0, 0 ), Z3i::Point( 1, 1, 1 ) ) - 4.5 ) < 1e-9 )
+    && ( std::abs( user( Z3i::Point( 0, 0, 0 ), Z3i::Point( 0, 0, -2 ) ) - 4.0 ) < 1e-9 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "user-defined mask with rational facet normals" << std::endl;
+
+  bool thrown = false;
+  try
+    {
+      dirs.push_back( Z3i::Vector( 1, -1, 0 ) );
+      weights.push_back( 4 );
+      Norm invalid( dirs, weights );
+    }
+  catch ( InputException & )
+    {
+      thrown = true;
+    }
+  nbok += thrown ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "InputException for a vector with a negative coordinate" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Compares the distance transformation of random sites, computed by
+ * GeodesicDistanceTransformation with the sites as sources, with a
+ * brute-force computation: the distances must be exact.
+ */
+bool testDistanceTransformation( Random & random, const Norm & norm,
+                                 const Z3i::Domain & domain, int nbSites )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock( "Distance transformation vs brute force" );
+  trace.info() << norm << " domain=" << domain << " sites=" << nbSites << std::endl;
+
+  typedef functors::TruePointPredicate<Z3i::Point> Predicate;
+  const Z3i::Vector extent = domain.upperBound() - domain.lowerBound() + Z3i::Vector::diagonal( 1 );
+  std::vector<Z3i::Point> sites;
+  for ( int i = 0; i < nbSites; ++i )
+    sites.push_back( domain.lowerBound()
+                     + Z3i::Vector( random( extent[ 0 ] ), random( extent[ 1 ] ), random( extent[ 2 ] ) ) );
+
+  const Predicate predicate = Predicate();
+  GeodesicDistanceTransformation<Predicate, Norm> dt( domain, predicate, norm );
+  dt.compute( sites.begin(), sites.end() );
+
+  unsigned int nbErrors = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      Norm::RawValue d = norm.rawDistance( *it, sites[ 0 ] );
+      Norm::Value value = norm( *it, sites[ 0 ] );
+      for ( unsigned int i = 1; i < sites.size(); ++i )
+        {
+          d = std::min( d, norm.rawDistance( *it, sites[ i ] ) );
+          value = std::min( value, norm( *it, sites[ i ] ) );
+        }
+      if ( ( dt.rawDistance( *it ) != d ) || ( std::abs( dt( *it ) - value ) > 1e-9 ) )
+        nbErrors++;
+    }
+  trace.info() << "nbErrors=" << nbErrors << std::endl;
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "distance transformation == brute force" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * In a box, the geodesic distance from a point is its chamfer
+ * distance.
+ */
+bool testGeodesic( const Norm & norm )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock( "Geodesic distances in a box" );
+
+  typedef functors::TruePointPredicate<Z3i::Point> Predicate;
+  const Z3i::Domain domain( Z3i::Point( -6, -4, -5 ), Z3i::Point( 8, 9, 7 ) );
+  const Predicate predicate = Predicate();
+  GeodesicDistanceTransformation<Predicate, Norm> geodesic( domain, predicate, norm );
+  std::vector<Z3i::Point> sources( 1, Z3i::Point( 1, 0, -2 ) );
+  geodesic.compute( sources.begin(), sources.end() );
+
+  unsigned int nbErrors = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    if ( geodesic.rawDistance( *it ) != norm.rawDistance( *it, sources[ 0 ] ) )
+      nbErrors++;
+  trace.info() << "nbErrors=" << nbErrors << std::endl;
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "geodesic distance == chamfer distance" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ChamferNorm3D" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  Random random;
+  const Norm mask3 = Norm::mask3x3x3();
+  const Norm mask5 = Norm::mask5x5x5();
+  const Z3i::Domain cube( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 19 ) );
+  const Z3i::Domain plane( Z3i::Point( 0, 0, 4 ), Z3i::Point( 63, 47, 4 ) );
+  bool res = testMasks()
+    && testDistanceTransformation( random, mask3, cube, 30 )
+    && testDistanceTransformation( random, mask5, cube, 30 )
+    && testDistanceTransformation( random, mask5, cube, 4 )
+    && testDistanceTransformation( random, mask3, plane, 40 )
+    && testDistanceTransformation( random, mask5, plane, 40 )
+    && testGeodesic( mask3 ) && testGeodesic( mask5 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
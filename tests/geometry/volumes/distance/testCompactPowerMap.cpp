@@ -0,0 +1,227 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCompactPowerMap.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class CompactPowerMap and the parallel
+ * ReducedMedialAxis extraction.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <map>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpPowerSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/PowerMap.h"
+#include "DGtal/geometry/volumes/distance/CompactPowerMap.h"
+#include "DGtal/geometry/volumes/distance/ReverseDistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ReducedMedialAxis.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CompactPowerMap.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares CompactPowerMap with PowerMap and
+ * ReverseDistanceTransformation, and the reduced medial axis with a
+ * sequential extraction, for random weighted points.
+ *
+ * @param size the size of the domain along each dimension.
+ * @param nbSites the number of weighted points.
+ * @param maxWeight the maximal weight of the points.
+ */
+template <DGtal::Dimension dim, DGtal::Dimension p>
+bool testCompactPowerMap( int size, int nbSites, int maxWeight )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<dim> Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Point Point;
+  typedef ImageContainerBySTLVector<Domain, DGtal::int64_t> WeightImage;
+  typedef ExactPredicateLpPowerSeparableMetric<Space, p> Metric;
+  typedef PowerMap<WeightImage, Metric> Power;
+  typedef CompactPowerMap<WeightImage, Metric> CompactPower;
+  typedef ReverseDistanceTransformation<WeightImage, Metric> RDT;
+
+  trace.beginBlock( "Comparing with PowerMap" );
+  trace.info() << "dim=" << dim << " p=" << p << " size=" << size
+               << " sites=" << nbSites << std::endl;
+
+  const Domain domain( Point::diagonal( 0 ), Point::diagonal( size - 1 ) );
+  WeightImage weights( domain );
+  for ( int i = 0; i < nbSites; ++i )
+    {
+      Point q;
+      for ( DGtal::Dimension k = 0; k < dim; ++k )
+        q[ k ] = rand() % size;
+      weights.setValue( q, 1 + rand() % maxWeight );
+    }
+
+  Metric metric;
+  Power power( domain, weights, metric );
+  CompactPower compact( domain, weights, metric );
+  RDT rdt( domain, weights, metric );
+  trace.info() << compact << std::endl;
+
+  nbok += compact.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "compact.isValid()" << std::endl;
+
+  unsigned int nbErrors = 0;
+  for ( typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      const Point site = compact( *it );
+      const typename CompactPower::Index i = compact.siteIndex( *it );
+      if ( ( site != power( *it ) )
+           || ( compact.site( i ) != site )
+           || ( compact.weight( i ) != weights( site ) )
+           || ( compact.powerDistance( *it ) != rdt( *it ) ) )
+        nbErrors++;
+    }
+  trace.info() << "nbErrors=" << nbErrors << std::endl;
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same sites and power distances" << std::endl;
+
+  //Sequential extraction of the reduced medial axis
+  std::map<Point, DGtal::int64_t> expected;
+  for ( typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      const Point v = power( *it );
+      if ( metric.powerDistance( *it, v, weights( v ) ) < 0 )
+        expected[ v ] = weights( v );
+    }
+
+  typename ReducedMedialAxis<Power>::Type rdma =
+    ReducedMedialAxis<Power>::getReducedMedialAxisFromPowerMap( power );
+  typename ReducedMedialAxis<CompactPower>::Type compactRdma =
+    ReducedMedialAxis<CompactPower>::getReducedMedialAxisFromPowerMap( compact );
+  trace.info() << "medial axis: " << expected.size() << " balls" << std::endl;
+
+  nbok += ( rdma.getPointer()->size() == expected.size() ) ? 1 : 0;
+  nb++;
+  nbok += ( compactRdma.getPointer()->size() == expected.size() ) ? 1 : 0;
+  nb++;
+  nbErrors = 0;
+  for ( typename std::map<Point, DGtal::int64_t>::const_iterator it = expected.begin(),
+          itend = expected.end(); it != itend; ++it )
+    if ( ( rdma.getPointer()->count( it->first ) == 0 )
+         || ( rdma( it->first ) != it->second )
+         || ( compactRdma.getPointer()->count( it->first ) == 0 )
+         || ( compactRdma( it->first ) != it->second ) )
+      nbErrors++;
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same reduced medial axis" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * CompactPowerMap without weighted point and with a small index type.
+ */
+bool testCompactPowerMapLimits()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<2> Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef Space::Point Point;
+  typedef ImageContainerBySTLVector<Domain, DGtal::int64_t> WeightImage;
+  typedef ExactPredicateLpPowerSeparableMetric<Space, 2> Metric;
+
+  trace.beginBlock( "Testing limits" );
+  const Domain domain( Point( 0, 0 ), Point( 19, 19 ) );
+  WeightImage weights( domain );
+  Metric metric;
+
+  CompactPowerMap<WeightImage, Metric> empty( domain, weights, metric );
+  nbok += ( empty.nbSites() == 0 ) ? 1 : 0;
+  nb++;
+  nbok += ( empty.siteIndex( Point( 3, 4 ) ) == 0 )
+    && ( empty( Point( 3, 4 ) ) == Point( 20, 20 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "no site" << std::endl;
+
+  for ( Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    weights.setValue( *it, 1 );
+  bool thrown = false;
+  try
+    {
+      CompactPowerMap<WeightImage, Metric, DGtal::uint8_t> small( domain, weights, metric );
+    }
+  catch ( InputException & )
+    {
+      thrown = true;
+    }
+  nbok += thrown ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "InputException when the sites cannot be numbered" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class CompactPowerMap" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 0 );
+  bool res = testCompactPowerMap<2, 2>( 64, 200, 40 )
+    && testCompactPowerMap<2, 1>( 64, 200, 10 )
+    && testCompactPowerMap<3, 2>( 24, 300, 20 )
+    && testCompactPowerMapLimits();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
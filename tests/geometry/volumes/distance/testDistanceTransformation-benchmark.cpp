@@ -0,0 +1,105 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDistanceTransformation-benchmark.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Scaling benchmark of DistanceTransformation on binary volumes. The
+ * sizes of the volumes are given as arguments (default: 512, which
+ * needs about 2GB; 1024 needs about 14GB). With OpenMP, run it with
+ * several values of OMP_NUM_THREADS.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <boost/lexical_cast.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+typedef functors::SimpleThresholdForegroundPredicate<Image> Predicate;
+typedef DistanceTransformation<Space, Predicate, L2Metric> DT;
+
+/**
+ * Computes the L2 distance transformation of a ball with random
+ * holes in a cube of side @a n.
+ * @return the maximal distance.
+ */
+double benchmark( int n )
+{
+  Domain domain( Point::diagonal( 0 ), Point::diagonal( n - 1 ) );
+  Image image( domain );
+  const Point c = Point::diagonal( n / 2 );
+  const DGtal::int64_t r2 = (DGtal::int64_t) ( n / 2 - 1 ) * ( n / 2 - 1 );
+  srand( 0 );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    {
+      const Point v = *it - c;
+      const DGtal::int64_t d2 = (DGtal::int64_t) v[ 0 ] * v[ 0 ]
+        + (DGtal::int64_t) v[ 1 ] * v[ 1 ] + (DGtal::int64_t) v[ 2 ] * v[ 2 ];
+      image.setValue( *it, ( d2 <= r2 && ( rand() % 100000 ) != 0 ) ? 1 : 0 );
+    }
+  Predicate predicate( image, 0 );
+
+  std::string title = "L2 distance transformation of a "
+    + boost::lexical_cast<std::string>( n ) + "^3 volume";
+  trace.beginBlock( title );
+  DT dt( &domain, &predicate, &l2Metric );
+  trace.endBlock();
+
+  double maxDistance = 0.0;
+  for ( DT::ConstRange::ConstIterator it = dt.constRange().begin(),
+          itE = dt.constRange().end(); it != itE; ++it )
+    maxDistance = std::max( maxDistance, (double) *it );
+  trace.info() << "Maximal distance = " << maxDistance << std::endl;
+  return maxDistance;
+}
+
+int main( int argc, char** argv )
+{
+#ifdef WITH_OPENMP
+  trace.info() << "OpenMP threads: " << omp_get_max_threads() << std::endl;
+#endif
+  if ( argc <= 1 )
+    benchmark( 512 );
+  for ( int i = 1; i < argc; ++i )
+    benchmark( atoi( argv[ i ] ) );
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
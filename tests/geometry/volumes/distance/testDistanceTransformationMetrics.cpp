@@ -33,6 +33,7 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLinfSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/InexactPredicateLpSeparableMetric.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -131,6 +132,46 @@ bool testCompareExactBruteForce(unsigned int size, unsigned int nb)
 
 
 
+template <typename Space>
+bool testCompareLinfBruteForce(unsigned int size, unsigned int nb)
+{
+  trace.beginBlock("Checking l_infinity metric");
+  typedef ExactPredicateLinfSeparableMetric<Space> MetricEx;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Point Point;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef functors::NotPointPredicate<Set> NegPredicate;
+  
+  Point low=Point::diagonal(0),
+  up=Point::diagonal(size);
+  
+  Domain domain(low,up);
+  Set set(domain);
+  
+  for(unsigned int i = 0; i<nb; ++i)
+  {
+    Point p;
+    for(unsigned int dim=0;  dim<Space::dimension;++dim)
+      p[dim]  = rand() % size;
+    set.insert(p);
+  }
+  
+  trace.info()<< "Testing metrics "<<MetricEx()<<std::endl;
+  trace.info()<< "Testing space dimension "<<Space::dimension<<std::endl;
+  trace.info()<< "Inserting "<<set.size() << " points."<<std::endl;
+  
+  NegPredicate negPred(set);
+  
+  typedef DistanceTransformation<Space, NegPredicate, MetricEx> DTEx;
+  MetricEx metricEx;
+  DTEx dtex(&domain, &negPred, &metricEx);
+  
+  bool res=checkVoronoi(dtex, negPred, metricEx);
+  
+  trace.endBlock();
+  return res;
+}
+
 template <typename Space>
 bool testCompareInexactBruteForce(double norm, unsigned int size, unsigned int nb)
 {
@@ -186,6 +227,11 @@ int main( int argc, char** argv )
   && testCompareExactBruteForce<Z2i::Space, 1>(16, 8)
   && testCompareExactBruteForce<Z3i::Space, 2>(16, 8)
   && testCompareExactBruteForce<Z2i::Space, 4>(16, 8)
+  && testCompareExactBruteForce<Z2i::Space, 3>(16, 8)
+  && testCompareExactBruteForce<Z3i::Space, 1>(10, 6)
+  && testCompareLinfBruteForce<Z2i::Space>(16, 3)
+  && testCompareLinfBruteForce<Z2i::Space>(16, 8)
+  && testCompareLinfBruteForce<Z3i::Space>(10, 5)
   && testCompareInexactBruteForce<Z2i::Space>(2.0,16, 8) 
   && testCompareInexactBruteForce<Z2i::Space>(1.33,16, 8)
   && testCompareInexactBruteForce<Z2i::Space>(2.6,16, 8) 
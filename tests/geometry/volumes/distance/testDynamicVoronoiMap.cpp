@@ -0,0 +1,205 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDynamicVoronoiMap.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class DynamicVoronoiMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <set>
+#include <iterator>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLinfSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/DynamicVoronoiMap.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+  << #x << std::endl;
+
+/**
+ * Updates a DynamicVoronoiMap by batches of random insertions and
+ * removals, and compares it with a DistanceTransformation computed
+ * from scratch after each batch. When spread is positive, the points
+ * of a batch lie in a cube of half-side spread, so that only a part of
+ * the map is repaired. The repaired points must be close to the
+ * Voronoi cells of the changed sites among the former sites and these
+ * sites: d(p,c) <= h(p) + |(1,...,1)| for some changed site c, h being
+ * the former distance.
+ */
+template <typename TSpace, typename TMetric>
+bool compareWithDistanceTransformation( const typename TSpace::Point & low,
+                                        const typename TSpace::Point & up,
+                                        int density, unsigned int batchSize,
+                                        unsigned int nbBatches,
+                                        int spread )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef typename TSpace::Point Point;
+  typedef HyperRectDomain<TSpace> Domain;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef functors::NotPointPredicate<Set> Predicate;
+  typedef DistanceTransformation<TSpace, Predicate, TMetric> DT;
+  typedef DynamicVoronoiMap<TSpace, TMetric> DMap;
+
+  trace.beginBlock( "Comparing with DistanceTransformation" );
+  Domain domain( low, up );
+  Set set( domain );
+  for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( rand() % density == 0 ) set.insert( *it );
+  Predicate predicate( set );
+  TMetric metric;
+
+  DMap dmap( domain, predicate, metric );
+  trace.info() << dmap << " domain=" << domain << std::endl;
+  INBLOCK_TEST( dmap.isValid() );
+
+  const Point extent = up - low + Point::diagonal( 1 );
+  unsigned int nbErrors = 0;
+  unsigned int nbWrongChanges = 0;
+  unsigned int nbNonLocal = 0;
+  DGtal::uint64_t nbRepaired = 0;
+  const double twoDelta = metric( Point::zero, Point::diagonal( 1 ) );
+  for ( unsigned int batch = 0; batch < nbBatches; ++batch )
+    {
+      DT before( domain, predicate, metric );
+      std::vector<Point> inserted, removed, changed;
+      if ( batch + 1 == nbBatches )
+        {
+          // The last batch removes every site.
+          removed.assign( set.begin(), set.end() );
+          set.clear();
+        }
+      else
+        {
+          Point center = low;
+          for ( typename Point::Dimension d = 0; d < Point::dimension; ++d )
+            center[ d ] += rand() % extent[ d ];
+          for ( unsigned int i = 0; i < batchSize; ++i )
+            {
+              Point p = low;
+              for ( typename Point::Dimension d = 0; d < Point::dimension; ++d )
+                p[ d ] = ( spread > 0 )
+                  ? std::min( up[ d ], std::max( low[ d ], center[ d ] - spread + rand() % ( 2 * spread + 1 ) ) )
+                  : low[ d ] + rand() % extent[ d ];
+              if ( std::find( inserted.begin(), inserted.end(), p ) != inserted.end()
+                   || std::find( removed.begin(), removed.end(), p ) != removed.end() )
+                continue;
+              if ( set( p ) ) { set.erase( p ); removed.push_back( p ); }
+              else { set.insert( p ); inserted.push_back( p ); }
+            }
+        }
+      const DGtal::uint64_t nbBatchRepaired =
+        dmap.update( inserted.begin(), inserted.end(), removed.begin(), removed.end(),
+                     std::back_inserter( changed ) );
+      nbRepaired += nbBatchRepaired;
+
+      DGtal::uint64_t nbNear = 0;
+      std::vector<Point> changedSites( inserted );
+      changedSites.insert( changedSites.end(), removed.begin(), removed.end() );
+      for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+        for ( unsigned int i = 0; i < changedSites.size(); ++i )
+          if ( metric( *it, changedSites[ i ] ) <= before( *it ) + twoDelta + 1e-9 )
+            {
+              ++nbNear;
+              break;
+            }
+      if ( nbBatchRepaired > nbNear ) ++nbNonLocal;
+
+      DT after( domain, predicate, metric );
+      std::set<Point> expected;
+      for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+        {
+          const bool isFinite = set.size() != 0;
+          if ( before( *it ) != after( *it ) ) expected.insert( *it );
+          if ( isFinite ? ( dmap.distance( *it ) != after( *it ) )
+               : ( dmap( *it ) != up + Point::diagonal( 1 ) ) )
+            ++nbErrors;
+          if ( dmap.isSite( *it ) != set( *it ) ) ++nbErrors;
+        }
+      const std::set<Point> output( changed.begin(), changed.end() );
+      if ( output.size() != changed.size() ) ++nbWrongChanges;
+      for ( typename std::set<Point>::const_iterator it = expected.begin(); it != expected.end(); ++it )
+        if ( ! output.count( *it ) ) ++nbWrongChanges;
+    }
+  trace.info() << "nbErrors=" << nbErrors << " nbWrongChanges=" << nbWrongChanges
+               << " nbRepaired=" << nbRepaired << "/" << nbBatches * domain.size() << std::endl;
+  INBLOCK_TEST( nbErrors == 0 );
+  INBLOCK_TEST( nbWrongChanges == 0 );
+  INBLOCK_TEST( nbNonLocal == 0 );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DynamicVoronoiMap" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 0 );
+  bool res = compareWithDistanceTransformation<Z2i::Space, Z2i::L1Metric>
+    ( Z2i::Point( -17, 3 ), Z2i::Point( 40, 61 ), 50, 20, 10, 0 )
+    && compareWithDistanceTransformation<Z2i::Space, Z2i::LinfMetric>
+    ( Z2i::Point( 0, 0 ), Z2i::Point( 50, 40 ), 100, 20, 10, 0 )
+    && compareWithDistanceTransformation<Z3i::Space, Z3i::L1Metric>
+    ( Z3i::Point( 0, 0, 0 ), Z3i::Point( 20, 17, 25 ), 300, 30, 8, 0 )
+    && compareWithDistanceTransformation<Z3i::Space, Z3i::LinfMetric>
+    ( Z3i::Point( -5, 3, 1 ), Z3i::Point( 20, 21, 23 ), 300, 30, 8, 0 )
+    && compareWithDistanceTransformation<Z2i::Space, Z2i::L2Metric>
+    ( Z2i::Point( 0, 0 ), Z2i::Point( 63, 63 ), 100, 20, 10, 0 )
+    && compareWithDistanceTransformation<Z3i::Space, Z3i::L2Metric>
+    ( Z3i::Point( 0, 0, 0 ), Z3i::Point( 24, 24, 24 ), 300, 30, 8, 0 )
+    && compareWithDistanceTransformation<Z2i::Space, Z2i::L2Metric>
+    ( Z2i::Point( 0, 0 ), Z2i::Point( 99, 99 ), 200, 20, 10, 4 )
+    && compareWithDistanceTransformation<Z3i::Space, Z3i::L2Metric>
+    ( Z3i::Point( 0, 0, 0 ), Z3i::Point( 39, 39, 39 ), 500, 30, 8, 3 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
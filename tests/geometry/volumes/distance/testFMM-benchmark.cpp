@@ -0,0 +1,108 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFMM-benchmark.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Benchmark of the candidate queues of FMM (SetCandidateQueue and
+ * IndexedHeapCandidateQueue) on a 3D L2 distance transformation from
+ * the center of a cube of side 128. The maximal distance values are
+ * given as arguments (default: 16, 32 and 64).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <boost/lexical_cast.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector<Domain, double> Image;
+typedef DigitalSetBySTLSet<Domain> Set;
+typedef functors::DomainPredicate<Domain> Predicate;
+typedef L2FirstOrderLocalDistance<Image, Set> Distance;
+
+/**
+ * Computes the FMM from the center of the domain up to @a maxValue.
+ *
+ * @tparam TCandidateQueue the candidate queue of FMM.
+ * @param domain the domain.
+ * @param maxValue the maximal distance value.
+ * @param name the name of the queue.
+ * @return the number of accepted points.
+ */
+template <typename TCandidateQueue>
+unsigned int benchmark( const Domain & domain, double maxValue, const std::string & name )
+{
+  typedef FMM<Image, Set, Predicate, Distance, TCandidateQueue> FMM;
+  Image image( domain );
+  Set set( domain );
+  const Point c = ( domain.lowerBound() + domain.upperBound() ) / 2;
+  image.setValue( c, 0.0 );
+  set.insert( c );
+  Predicate predicate( domain );
+
+  trace.beginBlock( name + " up to "
+                    + boost::lexical_cast<std::string>( maxValue ) );
+  FMM fmm( image, set, predicate, domain.size() + 1, maxValue );
+  fmm.compute();
+  trace.info() << fmm << std::endl;
+  trace.endBlock();
+  return set.size();
+}
+
+int main( int argc, char** argv )
+{
+  Domain domain( Point::diagonal( 0 ), Point::diagonal( 127 ) );
+  std::vector<double> maxValues;
+  for ( int i = 1; i < argc; ++i )
+    maxValues.push_back( atof( argv[ i ] ) );
+  if ( maxValues.empty() )
+    {
+      maxValues.push_back( 16 );
+      maxValues.push_back( 32 );
+      maxValues.push_back( 64 );
+    }
+
+  bool res = true;
+  for ( unsigned int i = 0; i < maxValues.size(); ++i )
+    res = res
+      && ( benchmark< SetCandidateQueue<Domain, double> >
+           ( domain, maxValues[ i ], "SetCandidateQueue" )
+           == benchmark< IndexedHeapCandidateQueue<Domain, double> >
+           ( domain, maxValues[ i ], "IndexedHeapCandidateQueue" ) );
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -653,6 +653,94 @@ bool testComparison(int size, int area, double dist)
 
 
 
+/**
+ * Comparison of the candidate queues:
+ * FMM must accept the same points with the same values
+ * with SetCandidateQueue and IndexedHeapCandidateQueue
+ */
+template<Dimension dim>
+bool testCandidateQueues(int size, double dist)
+{
+
+  static const DGtal::Dimension dimension = dim; 
+
+  //Domain
+  typedef HyperRectDomain< SpaceND<dimension, int> > Domain; 
+  typedef typename Domain::Point Point; 
+  Domain d(Point::diagonal(-size), Point::diagonal(size)); 
+  DomainPredicate<Domain> dp(d);
+
+  //Images and sets
+  typedef ImageContainerBySTLVector<Domain, double> Image;
+  typedef DigitalSetBySTLSet<Domain> Set; 
+  Image map1( d ), map2( d ); 
+  Set set1( d ), set2( d ); 
+  std::vector<Point> seeds; 
+  srand( 0 ); 
+  for (int i = 0; i < 5; ++i)
+    {
+      Point p; 
+      for (Dimension k = 0; k < dimension; ++k)
+	p[k] = rand() % (2*size+1) - size; 
+      seeds.push_back( p ); 
+    }
+
+  typedef L2FirstOrderLocalDistance<Image, Set> Distance; 
+  typedef FMM<Image, Set, DomainPredicate<Domain>, Distance > SetFMM; 
+  typedef FMM<Image, Set, DomainPredicate<Domain>, Distance,
+	      IndexedHeapCandidateQueue<Domain, double> > HeapFMM; 
+  SetFMM::initFromPointsRange( seeds.begin(), seeds.end(), map1, set1, 0.0 ); 
+  HeapFMM::initFromPointsRange( seeds.begin(), seeds.end(), map2, set2, 0.0 ); 
+
+  //computation
+  trace.beginBlock ( " FMM computation with both candidate queues " ); 
+  Distance distance1(map1, set1), distance2(map2, set2); 
+  unsigned long area = d.size() + 1; 
+  SetFMM fmm1( map1, set1, dp, area, dist, distance1 ); 
+  fmm1.compute(); 
+  trace.info() << fmm1 << std::endl; 
+  HeapFMM fmm2( map2, set2, dp, area, dist, distance2 ); 
+  fmm2.compute(); 
+  trace.info() << fmm2 << std::endl; 
+  trace.endBlock();
+
+  bool flagIsOk = ( set1.size() == set2.size() ) && fmm2.isValid(); 
+  typename Set::ConstIterator it = set1.begin(); 
+  typename Set::ConstIterator itEnd = set1.end(); 
+  for ( ; ( (it != itEnd)&&(flagIsOk) ); ++it)
+    {
+      if ( (set2.find(*it) == set2.end()) || (map1(*it) != map2(*it)) )
+	flagIsOk = false; 
+    }
+  return flagIsOk; 
+
+}
+
+
+/**
+ * IndexedHeapCandidateQueue must reject a domain with more points
+ * than its position map can index, whose size overflows
+ * Domain::Size.
+ */
+bool testCandidateQueueOverflow()
+{
+  typedef HyperRectDomain< SpaceND<2, int> > Domain; 
+  typedef Domain::Point Point; 
+  Domain d(Point(0,0), Point(65535,65535)); 
+
+  bool flagIsOk = false; 
+  try
+    {
+      IndexedHeapCandidateQueue<Domain, double> queue( d ); 
+    }
+  catch ( InputException & )
+    {
+      flagIsOk = true; 
+    }
+  return flagIsOk; 
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -693,6 +781,13 @@ int main ( int argc, char** argv )
     && testComparison<4,1>( size, area, 4*size+1 )
     ;
 
+  //candidate queues
+  res = res
+    && testCandidateQueues<2>( 50, 30 )
+    && testCandidateQueues<3>( 20, 100 )
+    && testCandidateQueueOverflow()
+    ;
+
   //&& ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
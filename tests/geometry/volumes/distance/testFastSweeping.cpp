@@ -0,0 +1,162 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFastSweeping.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class FastSweeping.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/FastSweeping.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+  << #x << std::endl;
+
+/**
+ * Compares FastSweeping with FMM from random seeds (with values 0 or
+ * 1), the computation being bounded by a ball.
+ *
+ * @tparam dim the dimension.
+ * @tparam TDistance the point functor (template).
+ * @param size the half side of the domain.
+ * @param threshold the value threshold.
+ * @param epsilon the tolerance on the values.
+ * @param margin the computation is bounded by the domain shrunk by
+ * @a margin.
+ */
+template <Dimension dim, template <typename, typename> class TDistance>
+bool compareWithFMM( int size, double threshold, double epsilon, int margin = 0 )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<dim, int> Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Domain::Point Point;
+  typedef ImageContainerBySTLVector<Domain, double> Image;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef functors::DomainPredicate<Domain> Predicate;
+  typedef TDistance<Image, Set> Distance;
+  typedef FMM<Image, Set, Predicate, Distance> FMM;
+  typedef FastSweeping<Image, Set, Predicate, Distance> Sweeping;
+
+  trace.beginBlock( "Comparing with FMM" );
+  Domain domain( Point::diagonal( -size ), Point::diagonal( size ) );
+  const int inner = size - margin;
+  Domain innerDomain( Point::diagonal( -inner ), Point::diagonal( inner ) );
+  Predicate predicate( innerDomain );
+  std::vector<Point> seeds;
+  for ( int i = 0; i < 4; ++i )
+    {
+      Point p;
+      for ( Dimension k = 0; k < dim; ++k )
+        p[ k ] = rand() % ( 2 * inner + 1 ) - inner;
+      seeds.push_back( p );
+    }
+
+  Image image1( domain ), image2( domain );
+  Set set1( domain ), set2( domain );
+  FMM::initFromPointsRange( seeds.begin(), seeds.end(), image1, set1, 0.0 );
+  FMM::initFromPointsRange( seeds.begin(), seeds.end(), image2, set2, 0.0 );
+  // A seed with a non null value.
+  set1.insert( Point::diagonal( 0 ) ); image1.setValue( Point::diagonal( 0 ), 1.0 );
+  set2.insert( Point::diagonal( 0 ) ); image2.setValue( Point::diagonal( 0 ), 1.0 );
+
+  Distance distance1( image1, set1 ), distance2( image2, set2 );
+  FMM fmm( image1, set1, predicate, domain.size() + 1, threshold, distance1 );
+  fmm.compute();
+  trace.info() << fmm << std::endl;
+  Sweeping sweeping( image2, set2, predicate, threshold, distance2 );
+  sweeping.compute();
+  trace.info() << sweeping << std::endl;
+  INBLOCK_TEST( sweeping.isValid() );
+
+  unsigned int nbErrors = 0;
+  double maxError = 0.0;
+  for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      if ( ( set2.find( *it ) != set2.end() ) && ! innerDomain.isInside( *it ) )
+        ++nbErrors;
+      const bool in1 = set1.find( *it ) != set1.end();
+      const bool in2 = set2.find( *it ) != set2.end();
+      if ( in1 != in2 )
+        {
+          // Only points at the threshold may differ.
+          const double v = in1 ? image1( *it ) : image2( *it );
+          if ( std::abs( std::abs( v ) - threshold ) > epsilon ) ++nbErrors;
+        }
+      else if ( in1 )
+        maxError = std::max( maxError, std::abs( image1( *it ) - image2( *it ) ) );
+    }
+  trace.info() << "nbErrors=" << nbErrors << " maxError=" << maxError << std::endl;
+  INBLOCK_TEST( nbErrors == 0 );
+  INBLOCK_TEST( maxError <= epsilon );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class FastSweeping" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 0 );
+  bool res = compareWithFMM<2, L2FirstOrderLocalDistance>( 40, 1000.0, 1e-9 )
+    && compareWithFMM<2, L2FirstOrderLocalDistance>( 40, 20.0, 1e-9 )
+    && compareWithFMM<3, L2FirstOrderLocalDistance>( 15, 1000.0, 1e-9 )
+    && compareWithFMM<2, L1LocalDistance>( 40, 1000.0, 0.0 )
+    && compareWithFMM<3, L1LocalDistance>( 15, 1000.0, 0.0 )
+    && compareWithFMM<2, L1LocalDistance>( 40, 1000.0, 0.0, 15 )
+    && compareWithFMM<3, L2FirstOrderLocalDistance>( 15, 1000.0, 1e-9, 5 )
+    && compareWithFMM<4, L2FirstOrderLocalDistance>( 5, 1000.0, 1e-9 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,278 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testGeodesicDistanceTransformation.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class GeodesicDistanceTransformation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/geometry/volumes/distance/ChamferNorm2D.h"
+#include "DGtal/geometry/volumes/distance/GeodesicDistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef experimental::ChamferNorm2D<Z2i::Space> Norm;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class GeodesicDistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the 3-4 chamfer norm.
+ */
+Norm mask34()
+{
+  Norm::Directions dirs, normals;
+  dirs.push_back( Z2i::Vector( 0, -1 ) );
+  dirs.push_back( Z2i::Vector( 1, -1 ) );
+  dirs.push_back( Z2i::Vector( 1, 0 ) );
+  dirs.push_back( Z2i::Vector( 1, 1 ) );
+  normals.push_back( Z2i::Vector( 1, -3 ) );
+  normals.push_back( Z2i::Vector( 3, -1 ) );
+  normals.push_back( Z2i::Vector( 3, 1 ) );
+  normals.push_back( Z2i::Vector( 1, 3 ) );
+  return Norm( dirs, normals, 3.0 );
+}
+
+/**
+ * @return the 5-7-11 chamfer norm.
+ */
+Norm mask5711()
+{
+  Norm::Directions dirs, normals;
+  dirs.push_back( Z2i::Vector( 0, -1 ) );
+  dirs.push_back( Z2i::Vector( 1, -2 ) );
+  dirs.push_back( Z2i::Vector( 1, -1 ) );
+  dirs.push_back( Z2i::Vector( 2, -1 ) );
+  dirs.push_back( Z2i::Vector( 1, 0 ) );
+  dirs.push_back( Z2i::Vector( 2, 1 ) );
+  dirs.push_back( Z2i::Vector( 1, 1 ) );
+  dirs.push_back( Z2i::Vector( 1, 2 ) );
+  normals.push_back( Z2i::Vector( 1, -5 ) );
+  normals.push_back( Z2i::Vector( 3, -4 ) );
+  normals.push_back( Z2i::Vector( 4, -3 ) );
+  normals.push_back( Z2i::Vector( 5, -1 ) );
+  normals.push_back( Z2i::Vector( 5, 1 ) );
+  normals.push_back( Z2i::Vector( 4, 3 ) );
+  normals.push_back( Z2i::Vector( 3, 4 ) );
+  normals.push_back( Z2i::Vector( 1, 5 ) );
+  return Norm( dirs, normals, 5.0 );
+}
+
+/**
+ * Reference geodesic distances, by Dijkstra's algorithm with a STL
+ * set as priority queue.
+ */
+template <typename TGeodesic, typename TPredicate>
+std::vector<Norm::RawValue>
+referenceDistances( const TGeodesic & geodesic, const TPredicate & predicate,
+                    const Norm & norm, const std::vector<Z2i::Point> & sources )
+{
+  typedef std::pair<Norm::RawValue, Z2i::Point> Node;
+  const Z2i::Domain & domain = geodesic.domain();
+  const Z2i::Point extent = domain.upperBound() - domain.lowerBound() + Z2i::Point::diagonal( 1 );
+  std::vector<Norm::RawValue> distances( domain.size(), TGeodesic::infinity() );
+  std::set<Node> queue;
+  for ( unsigned int i = 0; i < sources.size(); ++i )
+    if ( predicate( sources[ i ] ) )
+      {
+        const Z2i::Point p = sources[ i ] - domain.lowerBound();
+        distances[ p[ 0 ] + p[ 1 ] * extent[ 0 ] ] = 0;
+        queue.insert( Node( 0, sources[ i ] ) );
+      }
+  while ( ! queue.empty() )
+    {
+      const Node node = *queue.begin();
+      queue.erase( queue.begin() );
+      for ( unsigned int i = 0; i < geodesic.steps().size(); ++i )
+        {
+          const Z2i::Vector & v = geodesic.steps()[ i ];
+          const Z2i::Point q = node.second + v;
+          if ( ! domain.isInside( q ) || ! predicate( q ) ) continue;
+          const Norm::RawValue nd = node.first + norm.rawDistance( Z2i::Point::zero, v );
+          const Z2i::Point r = q - domain.lowerBound();
+          Norm::RawValue & dq = distances[ r[ 0 ] + r[ 1 ] * extent[ 0 ] ];
+          if ( nd < dq )
+            {
+              queue.erase( Node( dq, q ) );
+              dq = nd;
+              queue.insert( Node( nd, q ) );
+            }
+        }
+    }
+  return distances;
+}
+
+/**
+ * In a box, the geodesic distance is the chamfer distance to the
+ * closest source.
+ */
+bool testConvex( const Norm & norm )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock( "Geodesic distances in a box" );
+
+  typedef functors::TruePointPredicate<Z2i::Point> Predicate;
+  const Z2i::Domain domain( Z2i::Point( -10, -5 ), Z2i::Point( 30, 25 ) );
+  const Predicate predicate = Predicate();
+  GeodesicDistanceTransformation<Predicate, Norm> geodesic( domain, predicate, norm );
+  trace.info() << geodesic << std::endl;
+
+  std::vector<Z2i::Point> sources;
+  sources.push_back( Z2i::Point( 0, 0 ) );
+  sources.push_back( Z2i::Point( 20, 17 ) );
+  sources.push_back( Z2i::Point( -10, 25 ) );
+  geodesic.compute( sources.begin(), sources.end() );
+
+  nbok += geodesic.isValid() ? 1 : 0;
+  nb++;
+  // Normalized distance of a unit raw distance.
+  const Norm::Value unit = norm( Z2i::Point( 0, 0 ), Z2i::Point( 1, 0 ) )
+    / norm.rawDistance( Z2i::Point( 0, 0 ), Z2i::Point( 1, 0 ) );
+  unsigned int nbErrors = 0;
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      Norm::RawValue d = norm.rawDistance( *it, sources[ 0 ] );
+      for ( unsigned int i = 1; i < sources.size(); ++i )
+        d = std::min( d, norm.rawDistance( *it, sources[ i ] ) );
+      if ( ( geodesic.rawDistance( *it ) != d )
+           || ( std::abs( geodesic( *it ) - d * unit ) > 1e-9 ) )
+        nbErrors++;
+    }
+  trace.info() << "nbErrors=" << nbErrors << std::endl;
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "geodesic distance == chamfer distance" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * In an object with holes, the geodesic distances are the ones
+ * given by Dijkstra's algorithm, with or without a distance bound.
+ */
+bool testNonConvex( const Norm & norm )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock( "Geodesic distances in an object with holes" );
+
+  const Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 63, 47 ) );
+  Z2i::DigitalSet object( domain );
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      const Z2i::Point & p = *it;
+      // Walls with gaps, and random holes.
+      const bool wall = ( ( p[ 0 ] == 20 ) && ( p[ 1 ] > 5 ) )
+        || ( ( p[ 0 ] == 40 ) && ( p[ 1 ] < 40 ) );
+      if ( ! wall && ( rand() % 10 != 0 ) )
+        object.insertNew( p );
+    }
+
+  std::vector<Z2i::Point> sources;
+  sources.push_back( Z2i::Point( 5, 40 ) );
+  sources.push_back( Z2i::Point( 10, 3 ) );
+  sources.push_back( Z2i::Point( 20, 20 ) ); // in a wall: ignored
+
+  GeodesicDistanceTransformation<Z2i::DigitalSet, Norm> geodesic( domain, object, norm );
+  geodesic.compute( sources.begin(), sources.end() );
+  const std::vector<Norm::RawValue> expected =
+    referenceDistances( geodesic, object, norm, sources );
+
+  unsigned int nbErrors = 0;
+  unsigned int nbReached = 0;
+  Norm::RawValue maxDistance = 0;
+  unsigned int i = 0;
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it, ++i )
+    {
+      if ( geodesic.rawDistance( *it ) != expected[ i ] ) nbErrors++;
+      if ( expected[ i ] != geodesic.infinity() )
+        {
+          nbReached++;
+          maxDistance = std::max( maxDistance, expected[ i ] );
+        }
+    }
+  trace.info() << "reached=" << nbReached << "/" << object.size()
+               << " maxDistance=" << maxDistance << " nbErrors=" << nbErrors << std::endl;
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same distances as Dijkstra" << std::endl;
+
+  const Norm::RawValue bound = maxDistance / 2;
+  geodesic.compute( sources.begin(), sources.end(), bound );
+  nbErrors = 0;
+  i = 0;
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it, ++i )
+    {
+      const Norm::RawValue d = ( expected[ i ] <= bound ) ? expected[ i ] : geodesic.infinity();
+      if ( geodesic.rawDistance( *it ) != d ) nbErrors++;
+    }
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same distances up to " << bound << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class GeodesicDistanceTransformation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 0 );
+  const Norm norm34 = mask34();
+  const Norm norm5711 = mask5711();
+  bool res = testConvex( norm34 ) && testConvex( norm5711 )
+    && testNonConvex( norm34 ) && testNonConvex( norm5711 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,7 @@
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/CPowerSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLinfSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpPowerSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/InexactPredicateLpSeparableMetric.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -465,11 +466,100 @@ bool testSpecialCasesL2()
 }
 
 
+template <typename Metric>
+bool testRowKernels( const Metric & metric )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef Z3i::Point Point;
+  typedef typename Metric::RawValue RawValue;
+  
+  trace.beginBlock ( "Testing row kernels..." );
+  trace.info() << metric << std::endl;
+  srand( 0 );
+  for ( unsigned int i = 0; i < 1000; ++i )
+    {
+      const Dimension dim = rand() % 3;
+      Point starting( rand() % 20, rand() % 20, rand() % 20 );
+      starting[ dim ] = 0;
+      Point endpoint = starting;
+      endpoint[ dim ] = 2 + rand() % 30;
+      Point sites[ 3 ];
+      for ( unsigned int k = 0; k < 3; ++k )
+        sites[ k ] = Point( rand() % 20, rand() % 20, rand() % 20 );
+      sites[ 0 ][ dim ] = rand() % ( endpoint[ dim ] - 1 );
+      sites[ 1 ][ dim ] = sites[ 0 ][ dim ] + 1 + rand() % ( endpoint[ dim ] - sites[ 0 ][ dim ] - 1 );
+      sites[ 2 ][ dim ] = sites[ 1 ][ dim ] + 1 + rand() % ( endpoint[ dim ] - sites[ 1 ][ dim ] );
+      RawValue partials[ 3 ];
+      metric.partialRawDistances( sites, sites + 3, starting, dim, partials );
+      
+      bool ok = metric.hiddenBy( sites[ 0 ], sites[ 1 ], sites[ 2 ], starting, endpoint, dim )
+        == metric.hiddenBy( sites[ 0 ][ dim ], partials[ 0 ], sites[ 1 ][ dim ], partials[ 1 ],
+                            sites[ 2 ][ dim ], partials[ 2 ], starting[ dim ], endpoint[ dim ] );
+      Point point = starting;
+      for ( ; point[ dim ] <= endpoint[ dim ]; ++point[ dim ] )
+        {
+          ok = ok && ( metric.closest( point, sites[ 0 ], sites[ 2 ] )
+                       == metric.closest( point[ dim ], sites[ 0 ][ dim ], partials[ 0 ],
+                                          sites[ 2 ][ dim ], partials[ 2 ] ) );
+          ok = ok && ( metric.rawDistance( point, sites[ 1 ] )
+                       >= metric.partialRawDistance( point, sites[ 1 ], dim ) );
+        }
+      nbok += ok ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "row kernels match the point kernels" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testLinfMetric()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef ExactPredicateLinfSeparableMetric<Z2i::Space> Metric;
+  typedef Metric::RawValue RawValue;
+  Metric metric;
+  
+  trace.beginBlock ( "Testing separable metric l_infinity..." );
+  Z2i::Point a( 0, 0 ), b( 3, 4 );
+  nbok += ( metric( a, b ) == 4.0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "distance(a,b) == 4" << std::endl;
+  
+  //hiddenBy is checked against its definition: v is hidden iff no
+  //point of the row is strictly closer to v than to u and w.
+  srand( 0 );
+  for ( unsigned int i = 0; i < 1000; ++i )
+    {
+      Z2i::Point starting( 0, rand() % 20 ), endpoint( 2 + rand() % 25, starting[ 1 ] );
+      Z2i::Point u( rand() % ( endpoint[ 0 ] - 1 ), rand() % 20 );
+      Z2i::Point v( u[ 0 ] + 1 + rand() % ( endpoint[ 0 ] - u[ 0 ] - 1 ), rand() % 20 );
+      Z2i::Point w( v[ 0 ] + 1 + rand() % ( endpoint[ 0 ] - v[ 0 ] ), rand() % 20 );
+      bool hidden = true;
+      for ( Z2i::Point p = starting; p[ 0 ] <= endpoint[ 0 ]; ++p[ 0 ] )
+        {
+          const RawValue dv = metric.rawDistance( p, v );
+          if ( dv < metric.rawDistance( p, u ) && dv < metric.rawDistance( p, w ) )
+            hidden = false;
+        }
+      nbok += ( metric.hiddenBy( u, v, w, starting, endpoint, 0 ) == hidden ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "hiddenBy matches its definition" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 bool testConcepts()
 {
   BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<ExactPredicateLpSeparableMetric<Z2i::Space, 2> > ));
   BOOST_CONCEPT_ASSERT(( concepts::CPowerSeparableMetric<ExactPredicateLpPowerSeparableMetric<Z2i::Space, 2> > ));
   BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<InexactPredicateLpSeparableMetric<Z2i::Space> > ));  
+  BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<ExactPredicateLinfSeparableMetric<Z2i::Space> > ));
   return true;
 }
 
@@ -490,6 +580,12 @@ int main( int argc, char** argv )
     && testBinarySearch()
     && testSpecialCasesL2()
     && testSpecialCasesLp()
+    && testRowKernels( ExactPredicateLpSeparableMetric<Z3i::Space, 1>() )
+    && testRowKernels( ExactPredicateLpSeparableMetric<Z3i::Space, 2>() )
+    && testRowKernels( ExactPredicateLpSeparableMetric<Z3i::Space, 3>() )
+    && testRowKernels( ExactPredicateLpSeparableMetric<Z3i::Space, 4>() )
+    && testRowKernels( ExactPredicateLinfSeparableMetric<Z3i::Space>() )
+    && testLinfMetric()
     && testConcepts();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -0,0 +1,183 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOutOfCoreVoronoiMap.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class OutOfCoreVoronoiMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/OutOfCoreVoronoiMap.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+  << #x << std::endl;
+
+/**
+ * Consumer comparing the slabs with an in-memory map.
+ */
+template <typename TMap>
+struct SlabComparator
+{
+  SlabComparator( const TMap & aMap ) : map( aMap ), nbPoints( 0 ), nbErrors( 0 ) {}
+
+  template <typename TSlab>
+  void operator()( const TSlab & slab )
+  {
+    for ( typename TSlab::Domain::ConstIterator it = slab.domain().begin(),
+            itE = slab.domain().end(); it != itE; ++it, ++nbPoints )
+      if ( slab( *it ) != map( *it ) ) ++nbErrors;
+  }
+
+  const TMap & map;
+  unsigned int nbPoints;
+  unsigned int nbErrors;
+};
+
+/**
+ * Compares OutOfCoreVoronoiMap with VoronoiMap on random sites.
+ */
+template <typename TSpace, int p, typename TSite>
+bool compareWithVoronoiMap( const typename TSpace::Point & low,
+                            const typename TSpace::Point & up,
+                            int density, unsigned int slabSize )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef HyperRectDomain<TSpace> Domain;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef functors::NotPointPredicate<Set> Predicate;
+  typedef ExactPredicateLpSeparableMetric<TSpace, p> Metric;
+  typedef VoronoiMap<TSpace, Predicate, Metric> VMap;
+  typedef DistanceTransformation<TSpace, Predicate, Metric> DT;
+  typedef OutOfCoreVoronoiMap<TSpace, Predicate, Metric, TSite> OOCMap;
+
+  trace.beginBlock( "Comparing with VoronoiMap" );
+  Domain domain( low, up );
+  Set set( domain );
+  for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( rand() % density == 0 ) set.insert( *it );
+  Predicate predicate( set );
+  Metric metric;
+
+  VMap vmap( domain, predicate, metric );
+  DT dt( domain, predicate, metric );
+  OOCMap oocmap( domain, predicate, metric, "testOutOfCoreVoronoiMap.tmp", slabSize );
+  trace.info() << oocmap << " domain=" << domain << std::endl;
+  INBLOCK_TEST( oocmap.isValid() );
+
+  SlabComparator<VMap> vcomparator( vmap );
+  oocmap.process( vcomparator );
+  INBLOCK_TEST( vcomparator.nbErrors == 0 && vcomparator.nbPoints == domain.size() );
+  SlabComparator<DT> dcomparator( dt );
+  oocmap.processDistances( dcomparator );
+  INBLOCK_TEST( dcomparator.nbErrors == 0 && dcomparator.nbPoints == domain.size() );
+
+  unsigned int nbErrors = 0;
+  for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( oocmap( *it ) != vmap( *it ) || oocmap.distance( *it ) != dt( *it )
+         || oocmap.decode( oocmap.encode( *it ) ) != *it )
+      ++nbErrors;
+  INBLOCK_TEST( nbErrors == 0 );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * A domain with too many points for the sites must be rejected.
+ */
+bool testSiteOverflow()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef DigitalSetBySTLSet<Z2i::Domain> Set;
+  typedef functors::NotPointPredicate<Set> Predicate;
+  typedef OutOfCoreVoronoiMap<Z2i::Space, Predicate, Z2i::L2Metric, DGtal::uint16_t> OOCMap;
+
+  trace.beginBlock( "Site overflow" );
+  Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 299, 299 ) );
+  Set set( domain );
+  set.insert( Z2i::Point( 10, 10 ) );
+  Predicate predicate( set );
+  bool thrown = false;
+  try
+    {
+      OOCMap oocmap( domain, predicate, Z2i::l2Metric, "testOutOfCoreVoronoiMap.tmp", 10 );
+    }
+  catch ( InputException & )
+    {
+      thrown = true;
+    }
+  INBLOCK_TEST( thrown );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class OutOfCoreVoronoiMap" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  typedef SpaceND<4, int> Space4;
+  srand( 0 );
+  bool res = compareWithVoronoiMap<Z2i::Space, 2, DGtal::uint32_t>
+    ( Z2i::Point( -17, 3 ), Z2i::Point( 40, 61 ), 50, 7 )
+    && compareWithVoronoiMap<Z3i::Space, 2, DGtal::uint32_t>
+    ( Z3i::Point( -5, 3, 1 ), Z3i::Point( 30, 21, 23 ), 200, 4 )
+    && compareWithVoronoiMap<Z3i::Space, 1, DGtal::uint64_t>
+    ( Z3i::Point( 0, 0, 0 ), Z3i::Point( 20, 17, 31 ), 300, 32 )
+    && compareWithVoronoiMap<Z3i::Space, 3, DGtal::uint32_t>
+    ( Z3i::Point( 0, 0, 0 ), Z3i::Point( 25, 25, 25 ), 100000, 1 )
+    && compareWithVoronoiMap<Space4, 2, DGtal::uint32_t>
+    ( Space4::Point::diagonal( 0 ), Space4::Point( 9, 12, 7, 10 ), 80, 3 )
+    && testSiteOverflow();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
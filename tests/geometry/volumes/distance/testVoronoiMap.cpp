@@ -32,6 +32,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/images/CConstImage.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
 #include "DGtal/geometry/volumes/distance/VoronoiMap.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/InexactPredicateLpSeparableMetric.h"
@@ -524,6 +525,57 @@ bool testSimpleRandom3D()
 
 
 
+/**
+ * ImageContainerBySTLMap of points, constructible from a domain as
+ * required by VoronoiMap.
+ */
+struct PointMapImage: public ImageContainerBySTLMap<Z3i::Domain, Z3i::Point>
+{
+  PointMapImage( const Z3i::Domain &aDomain )
+    : ImageContainerBySTLMap<Z3i::Domain, Z3i::Point>( aDomain, Z3i::Point() )
+  {}
+};
+
+/**
+ * Voronoi map into an ImageContainerBySTLMap (sites initialized
+ * sequentially) compared with the default image.
+ */
+bool testVoronoiMapSTLMap()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock("Voronoi map into an ImageContainerBySTLMap");
+
+  Z3i::Domain domain( Z3i::Point(0,0,0), Z3i::Point(24,20,16) );
+  Z3i::DigitalSet mySet(domain);
+  for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+      it != itend; ++it)
+    mySet.insertNew( *it );
+  for(unsigned int i = 0 ; i < 32; ++i)
+    mySet.erase( Z3i::Point( rand() % 25, rand() % 21, rand() % 17 ) );
+
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> Voro;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric, PointMapImage> VoroMap;
+  L2Metric l2;
+  Voro voro( domain, mySet, l2 );
+  VoroMap voroMap( domain, mySet, l2 );
+
+  unsigned int nbErrors = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    if ( l2( *it, voro( *it ) ) != l2( *it, voroMap( *it ) ) )
+      nbErrors++;
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same distances, errors=" << nbErrors << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+
+
 bool testSimple4D()
 {
 
@@ -566,6 +618,7 @@ int main( int argc, char** argv )
     && testSimple3D() 
     && testSimpleRandom3D()
     && testSimple4D()
+    && testVoronoiMapSTLMap()
     ; // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -31,6 +31,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/volumes/KanungoNoise.h"
+#include "DGtal/geometry/volumes/KanungoNoiseGenerator.h"
 #include "DGtal/io/boards/Board2D.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/Shapes.h"
@@ -93,6 +94,83 @@ bool testKanungo2D()
   return nbok == nb;
 }
 
+/**
+ * Noisy objects drawn from one distance map: reproducibility and
+ * frequency of the reverted labels.
+ */
+bool testKanungoGenerator()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing KanungoNoiseGenerator ..." );
+
+  Z3i::Domain domain(Z3i::Point(0,0,0), Z3i::Point(40,40,40));
+  Z3i::DigitalSet set(domain);
+  Shapes<Z3i::Domain>::addNorm2Ball( set , Z3i::Point(20,20,20), 12);
+
+  typedef KanungoNoiseGenerator<Z3i::DigitalSet, Z3i::Domain> Generator;
+  Generator generator( set, domain );
+  trace.info() << generator << std::endl;
+  nbok += generator.isValid() ? 1 : 0;
+  nb++;
+
+  Generator::DigitalSet noisy( domain );
+  Generator::DigitalSet noisy2( domain );
+  generator.generate( 0.5, 42, noisy );
+  generator.generate( 0.5, 42, noisy2 );
+  nbok += ( noisy.words() == noisy2.words() ) ? 1 : 0;
+  nb++;
+  generator.generate( 0.5, 43, noisy2 );
+  nbok += ( noisy.words() != noisy2.words() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same seed, same object; other seed, other object" << std::endl;
+
+  //Points at distance 1 are reverted with probability alpha^2, the
+  //points far from the border (alpha^10 < 1e-9) are not reverted.
+  Z3i::DigitalSet border( domain );
+  Z3i::DigitalSet far( domain );
+  for(Z3i::Domain::ConstIterator it = domain.begin(), itend=domain.end(); it != itend; ++it)
+    {
+      const Z3i::Point p = *it;
+      const double d = ( p - Z3i::Point(20,20,20) ).norm();
+      if ( set( p ) && ( d <= 3.0 ) )
+        far.insertNew( p );
+      else
+        for ( Dimension k = 0; k < 3; ++k )
+          if ( domain.isInside( p + Z3i::Point::base( k ) )
+               && ( set( p ) != set( p + Z3i::Point::base( k ) ) ) )
+            {
+              border.insert( p );
+              border.insert( p + Z3i::Point::base( k ) );
+            }
+    }
+  const unsigned int nbSeeds = 50;
+  unsigned int nbReverted = 0;
+  unsigned int nbFarReverted = 0;
+  for ( unsigned int seed = 0; seed < nbSeeds; ++seed )
+    {
+      generator.generate( 0.5, seed, noisy );
+      for ( Z3i::DigitalSet::ConstIterator it = border.begin(); it != border.end(); ++it )
+        if ( noisy( *it ) != set( *it ) ) nbReverted++;
+      generator.generate( 0.1, seed, noisy );
+      for ( Z3i::DigitalSet::ConstIterator it = far.begin(); it != far.end(); ++it )
+        if ( ! noisy( *it ) ) nbFarReverted++;
+    }
+  const double ratio = nbReverted / (double) ( nbSeeds * border.size() );
+  trace.info() << "border ratio=" << ratio << " far=" << nbFarReverted << std::endl;
+  nbok += ( std::abs( ratio - 0.25 ) < 0.01 ) ? 1 : 0;
+  nb++;
+  nbok += ( nbFarReverted == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "reverted label frequencies" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 bool CheckingConcept()
 {
   BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate < KanungoNoise<Z2i::DigitalSet, Z2i::Domain> > ));
@@ -111,7 +189,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = CheckingConcept() && testKanungo2D(); // && ... other tests
+  bool res = CheckingConcept() && testKanungo2D() && testKanungoGenerator(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
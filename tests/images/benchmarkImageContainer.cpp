@@ -36,6 +36,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageContainerByBricks.h"
 
 #include "DGtal/helpers/StdDefs.h"
 #include <map>
@@ -50,6 +51,8 @@ using namespace DGtal;
 typedef DGtal::ImageContainerBySTLVector< Z2i::Domain, DGtal::int32_t> ImageVector2;
 typedef DGtal::ImageContainerBySTLMap< Z2i::Domain, DGtal::int32_t> ImageMap2;
 typedef DGtal::experimental::ImageContainerByHashTree< Z2i::Domain, DGtal::int32_t> ImageHash2;
+typedef DGtal::ImageContainerBySTLVector< Z3i::Domain, DGtal::int32_t> ImageVector3;
+typedef DGtal::ImageContainerByBricks< Z3i::Domain, DGtal::int32_t> ImageBricks3;
 
 template<typename Q>
 static void BM_Constructor(benchmark::State& state)
@@ -158,6 +161,116 @@ static void BM_DomainScan(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_DomainScan, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_DomainScan, ImageMap2)->Range(1<<3 , 1 << 10);
 
+/////// Neighborhood kernels
+
+template<typename Q>
+static void FillImage(Q & image)
+{
+  typename Q::Value v = 0;
+  for(typename Q::Domain::ConstIterator it = image.domain().begin(), itend=image.domain().end();
+      it != itend; ++it)
+    image.setValue( *it, v++ % 17 );
+}
+
+// Sum of the 6 direct neighbors of each interior voxel: the access
+// pattern of separable filters and distance transform passes.
+template<typename Q>
+static void BM_Neighborhood6(benchmark::State& state)
+{
+  typedef typename Q::Point Point;
+  typename Q::Domain dom(Point::diagonal(0), Point::diagonal(state.range_x()-1));
+  Q image( dom );
+  FillImage( image );
+  typename Q::Domain inner(Point::diagonal(1), Point::diagonal(state.range_x()-2));
+  int64_t cpt=0;
+  while (state.KeepRunning())
+    {
+      int64_t sum = 0;
+      for(typename Q::Domain::ConstIterator it = inner.begin(), itend=inner.end();
+          it != itend; ++it)
+        {
+          Point p = *it;
+          for(Dimension k = 0; k < Point::dimension; ++k)
+            {
+              --p[k]; sum += image(p);
+              p[k] += 2; sum += image(p);
+              --p[k];
+            }
+          cpt++;
+        }
+      CHECK( sum != std::numeric_limits<int64_t>::max()); //to prevent
+                                                           //compiler optimization
+    }
+  state.SetItemsProcessed(cpt);
+}
+BENCHMARK_TEMPLATE(BM_Neighborhood6, ImageVector3)->Range(1<<5 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Neighborhood6, ImageBricks3)->Range(1<<5 , 1 << 8);
+
+// Sum over the 5x5x5 box around each interior voxel: the access
+// pattern of integral invariant kernels.
+template<typename Q>
+static void BM_Box5(benchmark::State& state)
+{
+  typedef typename Q::Point Point;
+  typename Q::Domain dom(Point::diagonal(0), Point::diagonal(state.range_x()-1));
+  Q image( dom );
+  FillImage( image );
+  typename Q::Domain inner(Point::diagonal(2), Point::diagonal(state.range_x()-3));
+  int64_t cpt=0;
+  while (state.KeepRunning())
+    {
+      int64_t sum = 0;
+      for(typename Q::Domain::ConstIterator it = inner.begin(), itend=inner.end();
+          it != itend; ++it)
+        {
+          typename Q::Domain box( *it - Point::diagonal(2), *it + Point::diagonal(2) );
+          for(typename Q::Domain::ConstIterator itb = box.begin(), itbend=box.end();
+              itb != itbend; ++itb)
+            sum += image(*itb);
+          cpt++;
+        }
+      CHECK( sum != std::numeric_limits<int64_t>::max()); //to prevent
+                                                           //compiler optimization
+    }
+  state.SetItemsProcessed(cpt);
+}
+BENCHMARK_TEMPLATE(BM_Box5, ImageVector3)->Range(1<<5 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_Box5, ImageBricks3)->Range(1<<5 , 1 << 7);
+
+// Sweep along the last axis, as done by the last pass of separable
+// distance transforms.
+template<typename Q>
+static void BM_LastAxisSweep(benchmark::State& state)
+{
+  typedef typename Q::Point Point;
+  const Dimension last = Point::dimension - 1;
+  typename Q::Domain dom(Point::diagonal(0), Point::diagonal(state.range_x()-1));
+  Q image( dom );
+  FillImage( image );
+  Point upper = dom.upperBound();
+  upper[last] = 0;
+  typename Q::Domain base(dom.lowerBound(), upper);
+  int64_t cpt=0;
+  while (state.KeepRunning())
+    {
+      for(typename Q::Domain::ConstIterator it = base.begin(), itend=base.end();
+          it != itend; ++it)
+        {
+          Point p = *it;
+          typename Q::Value prev = image(p);
+          for(++p[last]; p[last] < state.range_x(); ++p[last])
+            {
+              prev = std::min( image(p), prev + 1 );
+              image.setValue( p, prev );
+              cpt++;
+            }
+        }
+    }
+  state.SetItemsProcessed(cpt);
+}
+BENCHMARK_TEMPLATE(BM_LastAxisSweep, ImageVector3)->Range(1<<5 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_LastAxisSweep, ImageBricks3)->Range(1<<5 , 1 << 8);
+
 
 
 
@@ -0,0 +1,185 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConcurrentTiledImage.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing classes ConcurrentImageCache and ConcurrentTiledImage.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/ConcurrentTiledImage.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+  << #x << std::endl;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+typedef ImageFactoryFromImage<VImage> MyImageFactory;
+typedef MyImageFactory::OutputImage OutputImage;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConcurrentTiledImage.
+///////////////////////////////////////////////////////////////////////////////
+
+bool testPointAccesses()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Testing concurrent point accesses" );
+  // 13 is not a multiple of 4: the last tiles are thinner.
+  VImage image( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 12, 15, 11 ) ) );
+  int i = 0;
+  for ( VImage::Iterator it = image.begin(); it != image.end(); ++it )
+    *it = i++;
+  MyImageFactory factory( image );
+  typedef ImageCacheWritePolicyWT<OutputImage, MyImageFactory> WritePolicy;
+  WritePolicy writePolicy( factory );
+  typedef ConcurrentTiledImage<VImage, MyImageFactory, WritePolicy> MyTiledImage;
+  MyTiledImage tiled( factory, writePolicy, 4, 6, 3 );
+  trace.info() << tiled << std::endl;
+  INBLOCK_TEST( tiled.isValid() && tiled.domainBlockCoords().size() == 5 * 4 * 4 );
+
+  const Z3i::Domain & domain = image.domain();
+  std::vector<Z3i::Point> points( domain.begin(), domain.end() );
+  const int n = (int) points.size();
+  unsigned int nbErrors = 0;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 16) reduction(+:nbErrors)
+#endif
+  for ( int j = 0; j < n; ++j )
+    {
+      // Jumps between tiles to stress eviction.
+      const Z3i::Point & p = points[ ( j * 37 ) % n ];
+      if ( tiled( p ) != image( p ) ) ++nbErrors;
+    }
+  INBLOCK_TEST( nbErrors == 0 );
+  INBLOCK_TEST( tiled.imageCache().nbPages() <= 6 );
+  trace.info() << tiled << std::endl;
+
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+  for ( int j = 0; j < n; ++j )
+    tiled.setValue( points[ j ], -j );
+  nbErrors = 0;
+  for ( int j = 0; j < n; ++j )
+    if ( image( points[ j ] ) != -j ) ++nbErrors;
+  INBLOCK_TEST( nbErrors == 0 );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testPinnedTiles()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Testing pinned tiles and prefetching" );
+  VImage image( Z3i::Domain( Z3i::Point( -8, -8, -8 ), Z3i::Point( 7, 7, 7 ) ) );
+  for ( VImage::Domain::ConstIterator it = image.domain().begin();
+        it != image.domain().end(); ++it )
+    image.setValue( *it, (*it)[ 0 ] + 100 * (*it)[ 2 ] );
+  MyImageFactory factory( image );
+  typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactory> WritePolicy;
+  WritePolicy writePolicy( factory );
+  typedef ConcurrentTiledImage<VImage, MyImageFactory, WritePolicy> MyTiledImage;
+  MyTiledImage tiled( factory, writePolicy, 4, 4, 2 );
+
+  // A pinned tile survives the eviction of all the others.
+  {
+    MyTiledImage::PinnedTile pinned = tiled.pinTile( Z3i::Point( 1, 2, 3 ) );
+    const OutputImage * tile = pinned.image();
+    Z3i::Domain blocks = tiled.domainBlockCoords();
+    for ( Z3i::Domain::ConstIterator it = blocks.begin(); it != blocks.end(); ++it )
+      tiled.prefetchTile( *it );
+    INBLOCK_TEST( tile == pinned.image()
+                  && tile->domain().lowerBound() == Z3i::Point( -4, 0, 4 )
+                  && (*tile)( Z3i::Point( -3, 1, 5 ) ) == -3 + 500 );
+  }
+  INBLOCK_TEST( tiled.imageCache().nbPages() <= 5 );
+
+  // Tile-wise parallel processing with prefetching and write-back.
+  Z3i::Domain blocks = tiled.domainBlockCoords();
+  std::vector<Z3i::Point> coords( blocks.begin(), blocks.end() );
+  const int n = (int) coords.size();
+  unsigned int nbErrors = 0;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(+:nbErrors)
+#endif
+  for ( int j = 0; j < n; ++j )
+    {
+      MyTiledImage::PinnedTile tile = tiled.pinTile( coords[ j ] );
+      tiled.prefetchNeighbors( coords[ j ] );
+      OutputImage & timage = *tile.image();
+      for ( OutputImage::Domain::ConstIterator it = timage.domain().begin(),
+              itE = timage.domain().end(); it != itE; ++it )
+        {
+          if ( timage( *it ) != (*it)[ 0 ] + 100 * (*it)[ 2 ] ) ++nbErrors;
+          timage.setValue( *it, j );
+        }
+    }
+  INBLOCK_TEST( nbErrors == 0 );
+  tiled.clearCacheAndResetCacheMisses();
+  nbErrors = 0;
+  for ( VImage::Domain::ConstIterator it = image.domain().begin();
+        it != image.domain().end(); ++it )
+    if ( image( *it ) != (int) tiled.tileKey( tiled.findBlockCoordsFromPoint( *it ) ) )
+      ++nbErrors;
+  INBLOCK_TEST( nbErrors == 0 && tiled.getCacheMissRead() == 0 );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ConcurrentTiledImage" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testPointAccesses()
+    && testPinnedTiles();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
@@ -290,6 +291,107 @@ bool testSimple()
     return nbok == nb;
 }
 
+/// Reads a page through the cache as TiledImage does, loading it on a miss.
+template <typename TImageCache>
+void accessPage(TImageCache & imageCache, const Z2i::Domain & aDomain)
+{
+    if (imageCache.getPage(aDomain))
+      imageCache.incCacheHitRead();
+    else
+    {
+      imageCache.incCacheMissRead();
+      imageCache.update(aDomain);
+    }
+}
+
+bool testPoliciesAndStatistics()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing LRU and 2Q read policies, statistics");
+    
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    VImage image(Z2i::Domain(Z2i::Point(0,0), Z2i::Point(7,7)));
+    int i = 1;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+    
+    typedef ImageFactoryFromImage<VImage > MyImageFactoryFromImage;
+    MyImageFactoryFromImage factImage(image);
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    
+    // 16 tiles of 2x2 pixels
+    std::vector<Z2i::Domain> tiles;
+    for (int y = 0; y < 8; y += 2)
+      for (int x = 0; x < 8; x += 2)
+        tiles.push_back(Z2i::Domain(Z2i::Point(x,y), Z2i::Point(x+1,y+1)));
+    
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWB;
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(factImage);
+    
+    // 1) LRU: a page read again is not the next one to be detached
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyLRU;
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU(factImage, 2);
+    typedef ImageCache<OutputImage, MyImageFactoryFromImage, MyImageCacheReadPolicyLRU, MyImageCacheWritePolicyWB> MyImageCacheLRU;
+    MyImageCacheLRU imageCacheLRU(factImage, imageCacheReadPolicyLRU, imageCacheWritePolicyWB);
+    
+    OutputImage::Value aValue;
+    imageCacheLRU.update(tiles[0]);
+    imageCacheLRU.update(tiles[1]);
+    nbok += (imageCacheLRU.read(Z2i::Point(1,1), aValue) && (aValue == 10)) ? 1 : 0;
+    nb++;
+    imageCacheLRU.update(tiles[2]); // detaches tiles[1]
+    trace.info() << "LRU: " << imageCacheLRU << endl;
+    nbok += ( imageCacheLRU.getPage(tiles[0]) && !imageCacheLRU.getPage(tiles[1]) && imageCacheLRU.getPage(tiles[2]) ) ? 1 : 0;
+    nb++;
+    nbok += ( (imageCacheLRU.getNbEvictions() == 1)
+              && (imageCacheLRU.getNbBytesLoaded() == 3*4*sizeof(int)) ) ? 1 : 0;
+    nb++;
+    
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    
+    // 2) 2Q versus LRU: two hot tiles survive a sweep over the other tiles with 2Q only
+    typedef ImageCacheReadPolicy2Q<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicy2Q;
+    MyImageCacheReadPolicy2Q imageCacheReadPolicy2Q(factImage, 4, 1, 16);
+    typedef ImageCache<OutputImage, MyImageFactoryFromImage, MyImageCacheReadPolicy2Q, MyImageCacheWritePolicyWB> MyImageCache2Q;
+    MyImageCache2Q imageCache2Q(factImage, imageCacheReadPolicy2Q, imageCacheWritePolicyWB);
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU4(factImage, 4);
+    MyImageCacheLRU imageCacheLRU4(factImage, imageCacheReadPolicyLRU4, imageCacheWritePolicyWB);
+    
+    const unsigned int sequence[] = { 0, 1, 2, 3, 4, 5, 0, 1 };
+    for (unsigned int j = 0; j < 8; j++)
+    {
+      accessPage(imageCache2Q, tiles[sequence[j]]);
+      accessPage(imageCacheLRU4, tiles[sequence[j]]);
+    }
+    for (unsigned int j = 6; j < 16; j++) // sweep
+    {
+      accessPage(imageCache2Q, tiles[j]);
+      accessPage(imageCacheLRU4, tiles[j]);
+    }
+    trace.info() << "2Q:  " << imageCache2Q << endl;
+    trace.info() << "LRU: " << imageCacheLRU4 << endl;
+    nbok += ( imageCache2Q.getPage(tiles[0]) && imageCache2Q.getPage(tiles[1]) ) ? 1 : 0;
+    nb++;
+    nbok += ( !imageCacheLRU4.getPage(tiles[0]) && !imageCacheLRU4.getPage(tiles[1]) ) ? 1 : 0;
+    nb++;
+    nbok += ( (imageCache2Q.getCacheMissRead() == 18) && (imageCache2Q.getCacheHitRead() == 0)
+              && (imageCache2Q.getNbEvictions() == 14) ) ? 1 : 0;
+    nb++;
+    
+    imageCache2Q.clearCacheAndResetCacheMisses();
+    nbok += ( (imageCache2Q.getCacheMissRead() == 0) && (imageCache2Q.getNbBytesLoaded() == 0)
+              && !imageCache2Q.getPage(tiles[0]) ) ? 1 : 0;
+    nb++;
+    
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    
+    trace.endBlock();
+    
+    return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -301,7 +403,7 @@ int main( int argc, char** argv )
         trace.info() << " " << argv[ i ];
     trace.info() << endl;
 
-    bool res = testSimple(); // && ... other tests
+    bool res = testSimple() && testPoliciesAndStatistics(); // && ... other tests
 
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
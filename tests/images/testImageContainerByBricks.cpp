@@ -0,0 +1,154 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByBricks.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class ImageContainerByBricks.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByBricks.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+  << #x << std::endl;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByBricks.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename TImage>
+bool testBricks( const typename TImage::Domain & domain )
+{
+  typedef typename TImage::Domain Domain;
+  typedef typename TImage::Point Point;
+  typedef ImageContainerBySTLVector<Domain, int> RefImage;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< TImage > ));
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ImageContainerByBricks." );
+  TImage image( domain, -1 );
+  RefImage ref( domain );
+  trace.info() << image << std::endl;
+  INBLOCK_TEST( image.isValid() && image.capacity() >= domain.size() );
+
+  // Indices are a bijection between points and non-padding values.
+  std::set<typename TImage::Size> indices;
+  bool ok = true;
+  for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      indices.insert( image.index( *it ) );
+      ok = ok && ( image.pointFromIndex( image.index( *it ) ) == *it );
+    }
+  INBLOCK_TEST( ok && indices.size() == domain.size() );
+
+  int v = 0;
+  for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it, ++v )
+    {
+      image.setValue( *it, v );
+      ref.setValue( *it, v );
+    }
+  ok = true;
+  for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    ok = ok && ( image( *it ) == ref( *it ) );
+  INBLOCK_TEST( ok );
+
+  // Ranges follow the domain order.
+  typename TImage::ConstRange r = image.constRange();
+  typename RefImage::ConstRange rr = ref.constRange();
+  INBLOCK_TEST( std::equal( r.begin(), r.end(), rr.begin() ) );
+
+  // Brick iterators visit every point once, in memory order.
+  typename TImage::Size n = 0;
+  typename TImage::Size lastIndex = 0;
+  ok = true;
+  for ( typename TImage::ConstIterator it = image.begin(), itE = image.end();
+        it != itE; ++it, ++n )
+    {
+      ok = ok && domain.isInside( it.point() ) && ( *it == ref( it.point() ) );
+      ok = ok && ( ( n == 0 ) || ( it.index() > lastIndex ) );
+      lastIndex = it.index();
+    }
+  INBLOCK_TEST( ok && n == domain.size() );
+  for ( typename TImage::Iterator it = image.begin(), itE = image.end();
+        it != itE; ++it )
+    *it = 7;
+  typename TImage::ConstIterator itLast = image.end();
+  --itLast;
+  INBLOCK_TEST( image( domain.lowerBound() ) == 7 && image( domain.upperBound() ) == 7
+                && *itLast == 7 && domain.isInside( itLast.point() ) );
+
+  srand( 1 );
+  ok = true;
+  for ( unsigned int i = 0; i < 1000; ++i )
+    {
+      Point p;
+      for ( Dimension k = 0; k < Point::dimension; ++k )
+        p[ k ] = domain.lowerBound()[ k ]
+          + rand() % ( domain.upperBound()[ k ] - domain.lowerBound()[ k ] + 1 );
+      image.setValue( p, i );
+      ok = ok && ( image( p ) == (int) i );
+    }
+  INBLOCK_TEST( ok );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageContainerByBricks" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  typedef ImageContainerByBricks<Z2i::Domain, int, 2> Image2;
+  typedef ImageContainerByBricks<Z3i::Domain, int> Image3;
+  bool res = testBricks<Image2>( Z2i::Domain( Z2i::Point( -5, 3 ), Z2i::Point( 12, 9 ) ) )
+    && testBricks<Image3>( Z3i::Domain( Z3i::Point( -3, -9, 0 ), Z3i::Point( 17, 4, 8 ) ) )
+    && testBricks<Image3>( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 15, 15, 15 ) ) );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,196 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByRuns.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class ImageContainerByRuns.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByRuns.h"
+#include "DGtal/images/imagesSetsUtils/ImageFromSet.h"
+#include "DGtal/images/imagesSetsUtils/SetFromImage.h"
+#include "DGtal/kernel/sets/DigitalSetByRuns.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+  << #x << std::endl;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByRuns.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename TImage1, typename TImage2>
+bool sameImages( const TImage1 & i1, const TImage2 & i2 )
+{
+  typedef typename TImage1::Domain Domain;
+  for ( typename Domain::ConstIterator it = i1.domain().begin(),
+          itE = i1.domain().end(); it != itE; ++it )
+    if ( i1( *it ) != i2( *it ) ) return false;
+  return true;
+}
+
+bool testImageContainerByRuns()
+{
+  using namespace Z3i;
+  typedef ImageContainerByRuns<Domain, int> Image;
+  typedef ImageContainerBySTLVector<Domain, int> RefImage;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< Image > ));
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing values and runs." );
+  Domain domain( Point( -6, -3, 0 ), Point( 6, 3, 3 ) );
+  Image image( domain, 0 );
+  RefImage ref( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    ref.setValue( *it, 0 );
+  INBLOCK_TEST( image.nbRuns() == image.nbScanlines() && image.isValid() );
+  image.setValue( Point( 0, 0, 0 ), 3 );
+  INBLOCK_TEST( image( Point( 0, 0, 0 ) ) == 3 && image( Point( 1, 0, 0 ) ) == 0
+                && image.scanline( image.scanlineIndex( Point( 0, 0, 0 ) ) ).size() == 3 );
+  image.setValue( Point( 0, 0, 0 ), 0 );
+  INBLOCK_TEST( image.scanline( image.scanlineIndex( Point( 0, 0, 0 ) ) ).size() == 1
+                && image.isValid() );
+  image.setRun( Point( 0, 1, 1 ), -6, 2, 7 );
+  INBLOCK_TEST( image( Point( -6, 1, 1 ) ) == 7 && image( Point( 2, 1, 1 ) ) == 7
+                && image( Point( 3, 1, 1 ) ) == 0
+                && image.scanline( image.scanlineIndex( Point( 0, 1, 1 ) ) ).size() == 2 );
+  image.setRun( Point( 0, 1, 1 ), -6, 6, 0 );
+  INBLOCK_TEST( image.nbRuns() == image.nbScanlines() );
+
+  srand( 0 );
+  for ( unsigned int i = 0; i < 3000; ++i )
+    {
+      Point p( rand() % 13 - 6, rand() % 7 - 3, rand() % 4 );
+      int v = rand() % 3;
+      if ( rand() % 4 )
+        {
+          image.setValue( p, v );
+          ref.setValue( p, v );
+        }
+      else
+        {
+          int x2 = std::min( 6, p[ 0 ] + rand() % 5 );
+          image.setRun( p, p[ 0 ], x2, v );
+          for ( Point q = p; q[ 0 ] <= x2; ++q[ 0 ] )
+            ref.setValue( q, v );
+        }
+    }
+  INBLOCK_TEST( sameImages( image, ref ) && image.isValid() );
+  trace.info() << image << std::endl;
+
+  // Values through the range are in the domain order.
+  Image::ConstRange r = image.constRange();
+  Domain::ConstIterator itD = domain.begin();
+  bool ok = true;
+  for ( Image::ConstRange::ConstIterator it = r.begin(); it != r.end(); ++it, ++itD )
+    ok = ok && ( *it == ref( *itD ) );
+  INBLOCK_TEST( ok );
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing span iterators." );
+  bool okSpan = true;
+  for ( Dimension k = 0; k < 3; ++k )
+    {
+      Point c( 0, 1, 2 );
+      Point q = c;
+      q[ k ] = domain.lowerBound()[ k ];
+      for ( Image::SpanIterator it = image.spanBegin( q, k ),
+              itE = image.spanEnd( q, k ); it != itE; ++it, ++q[ k ] )
+        okSpan = okSpan && ( *it == ref( q ) );
+      okSpan = okSpan && ( q[ k ] == domain.upperBound()[ k ] + 1 );
+    }
+  INBLOCK_TEST( okSpan );
+  Point s( -6, 2, 3 );
+  for ( Image::SpanIterator it = image.spanBegin( s, 0 ),
+          itE = image.spanEnd( s, 0 ); it != itE; ++it )
+    image.setValue( it, 5 );
+  INBLOCK_TEST( image.scanline( image.scanlineIndex( s ) ).size() == 1
+                && image( Point( 4, 2, 3 ) ) == 5 );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testConversions()
+{
+  using namespace Z2i;
+  typedef ImageContainerByRuns<Domain, unsigned char> Image;
+  typedef DigitalSetByRuns<Domain> RunSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ImageFromSet / SetFromImage." );
+  Domain domain( Point( -20, -20 ), Point( 20, 20 ) );
+  RunSet disk( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( (*it).norm() <= 12.0 ) disk.insert( *it );
+
+  Image image = ImageFromSet<Image>::create( disk, 1 );
+  INBLOCK_TEST( image.domain().lowerBound() == Point( -12, -12 )
+                && image( Point( 0, 0 ) ) == 1 && image( Point( 12, 12 ) ) == 0 );
+  INBLOCK_TEST( image.nbRuns() <= 3 * image.nbScanlines() );
+
+  RunSet back( domain );
+  SetFromImage<RunSet>::append<Image>( back, image, 0, 1 );
+  INBLOCK_TEST( back.size() == disk.size() && back.nbRuns() == disk.nbRuns() );
+  RunSet diff( back );
+  diff -= disk;
+  INBLOCK_TEST( diff.empty() );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageContainerByRuns" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testImageContainerByRuns()
+    && testConversions();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
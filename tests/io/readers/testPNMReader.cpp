@@ -35,6 +35,9 @@
 #include "DGtal/io/readers/PPMReader.h"
 #include "DGtal/io/readers/PGMReader.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/io/writers/PGMWriter.h"
+#include <fstream>
 #include "DGtal/images/imagesSetsUtils/SetFromImage.h"
 #include "ConfigTest.h"
 
@@ -146,6 +149,65 @@ bool testPNM3DASCIIReader()
     return nbok == nb;
 }
 
+bool testPNMBinaryReader()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing binary pgm reader ..." );
+
+  typedef ImageSelector < Z2i::Domain, unsigned int>::Type Image;
+  typedef ImageContainerBySTLMap < Z2i::Domain, unsigned int> MapImage;
+  Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 12, 6 ) );
+  Image image( domain );
+  for ( Z2i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    image.setValue( *it, ( 7 * (*it)[ 0 ] + 31 * (*it)[ 1 ] ) % 256 );
+  PGMWriter<Image, functors::Cast<unsigned char> >::exportPGM( "testPNMBinaryReader.pgm", image,
+                                                                functors::Cast<unsigned char>() );
+  Image image2 = PGMReader<Image>::importPGM( "testPNMBinaryReader.pgm" );
+  MapImage image3 = PGMReader<MapImage>::importPGM( "testPNMBinaryReader.pgm" );
+  bool ok = image2.domain().upperBound() == domain.upperBound();
+  for ( Z2i::Domain::ConstIterator it = domain.begin(); ok && it != domain.end(); ++it )
+    ok = ( image2( *it ) == image( *it ) ) && ( image3( *it ) == image( *it ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "P5 written == P5 read (vector and map images)" << std::endl;
+
+  // 16 bits values, most significant byte first.
+  {
+    std::ofstream out( "testPNMBinaryReader16.pgm" );
+    out << "P5" << std::endl << "3 2" << std::endl << "1000" << std::endl;
+    for ( unsigned int i = 0; i < 6; ++i )
+      out << (char)( ( 150 * i ) >> 8 ) << (char)( ( 150 * i ) & 0xff );
+  }
+  Image image16 = PGMReader<Image>::importPGM( "testPNMBinaryReader16.pgm" );
+  nbok += ( image16( Z2i::Point( 0, 1 ) ) == 0 && image16( Z2i::Point( 2, 1 ) ) == 300
+            && image16( Z2i::Point( 0, 0 ) ) == 450 && image16( Z2i::Point( 2, 0 ) ) == 750 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "16 bits P5 values" << std::endl;
+
+  typedef ImageSelector < Z3i::Domain, unsigned int>::Type Image3D;
+  typedef ImageContainerBySTLMap < Z3i::Domain, unsigned int> MapImage3D;
+  Z3i::Domain domain3( Z3i::Point( 0, 0, 0 ), Z3i::Point( 4, 5, 6 ) );
+  Image3D image3D( domain3 );
+  for ( Z3i::Domain::ConstIterator it = domain3.begin(); it != domain3.end(); ++it )
+    image3D.setValue( *it, (*it)[ 0 ] + 10 * (*it)[ 1 ] + 30 * (*it)[ 2 ] );
+  PGMWriter<Image3D, functors::Cast<unsigned char> >::exportPGM3D( "testPNMBinaryReader.pgm3d", image3D,
+                                                                    functors::Cast<unsigned char>() );
+  Image3D image3D2 = PGMReader<Image3D>::importPGM3D( "testPNMBinaryReader.pgm3d" );
+  MapImage3D image3D3 = PGMReader<MapImage3D>::importPGM3D( "testPNMBinaryReader.pgm3d" );
+  ok = image3D2.domain().upperBound() == domain3.upperBound();
+  for ( Z3i::Domain::ConstIterator it = domain3.begin(); ok && it != domain3.end(); ++it )
+    ok = ( image3D2( *it ) == image3D( *it ) ) && ( image3D3( *it ) == image3D( *it ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "P5-3D written == P5-3D read (vector and map images)" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -157,7 +219,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testPNMReader() && testPNM3DReader() && testPNM3DASCIIReader(); // && ... other tests
+  bool res = testPNMReader() && testPNM3DReader() && testPNM3DASCIIReader()
+    && testPNMBinaryReader(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <fstream>
+#include <cstdio>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/kernel/SpaceND.h"
@@ -102,6 +104,143 @@ bool testRawReader2D()
   return nbok == nb;
 }
 
+bool testRawReaderMapped()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing Raw reader (mapped) ..." );
+
+  typedef SpaceND<2> Space2;
+  typedef HyperRectDomain<Space2> TDomain;
+  typedef TDomain::Vector Vector;
+
+  typedef SpaceND<3> Space3;
+  typedef HyperRectDomain<Space3> TDomain3;
+  typedef TDomain3::Vector Vector3;
+
+  typedef ImageSelector<TDomain, unsigned char>::Type Image;
+  typedef ImageSelector<TDomain3, unsigned int>::Type Image32;
+
+  std::string filename = testPath + "samples/raw2D-64x64.raw";
+  Vector ext( 16, 16 );
+  Image image = RawReader<Image>::importRaw8( filename, ext );
+  RawReader<Image>::MappedImage8 mapped = RawReader<Image>::importRaw8Mapped( filename, ext );
+  trace.info() << mapped << endl;
+  bool same = true;
+  for ( TDomain::ConstIterator it = image.domain().begin(), itend = image.domain().end();
+        same && it != itend; ++it )
+    same = ( mapped( *it ) == image( *it ) );
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mapped values == imported values (8bits)" << std::endl;
+
+  std::string filename2 = testPath + "samples/raw32bits5x5x5.raw";
+  Vector3 ext2( 5, 5, 5 );
+  RawReader<Image32>::MappedImage32 mapped2 =
+    RawReader<Image32>::importRaw32Mapped( filename2, ext2,
+                                           RawReader<Image32>::MappedImage32::COPY_ON_WRITE );
+  TDomain3::Point pointA( 2, 3, 4 );
+  nbok += ( mapped2( pointA ) == 250000*2*3*4 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mapped value (32bits) == 250000*2*3*4" << std::endl;
+
+  mapped2.setValue( pointA, 17 );
+  RawReader<Image32>::MappedImage32 mapped3 = RawReader<Image32>::importRaw32Mapped( filename2, ext2 );
+  nbok += ( mapped2( pointA ) == 17 && mapped3( pointA ) == 250000*2*3*4 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "copy-on-write does not modify the file" << std::endl;
+
+  // The file is too short for this extent.
+  bool caught = false;
+  try
+    {
+      RawReader<Image32>::importRaw32Mapped( filename2, Vector3( 6, 5, 5 ) );
+    }
+  catch ( DGtal::IOException & e )
+    {
+      caught = true;
+    }
+  nbok += caught ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "IOException on a too short file" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Maps a sparse file of 2^32 bytes as a 2048x2048x1024 volume: the
+ * element count and the offsets must not wrap at 2^32.
+ */
+bool testRawReaderMappedLarge()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing Raw reader (mapped) on 2^32 values ..." );
+
+#if !defined(WIN32)
+  typedef SpaceND<3> Space3;
+  typedef HyperRectDomain<Space3> TDomain3;
+  typedef TDomain3::Vector Vector3;
+  typedef ImageSelector<TDomain3, unsigned char>::Type Image;
+  typedef RawReader<Image>::MappedImage8 MappedImage;
+
+  // Only the last byte is written: the file is sparse on most file systems.
+  const std::string filename = "testRawReaderMappedLarge.raw";
+  const DGtal::uint64_t size = (DGtal::uint64_t) 2048 * 2048 * 1024;
+  {
+    std::ofstream out( filename.c_str(), std::ios::out | std::ios::binary );
+    out.seekp( (std::streamoff) ( size - 1 ) );
+    out.put( (char) 42 );
+  }
+  const Vector3 ext( 2048, 2048, 1024 );
+  bool ok = false;
+  try
+    {
+      MappedImage mapped = RawReader<Image>::importRaw8Mapped( filename, ext );
+      trace.info() << mapped << endl;
+      const TDomain3::Point last = mapped.domain().upperBound();
+      ok = ( mapped.nbValues() == size )
+        && ( mapped.linearized( last ) == size - 1 )
+        && ( mapped( last ) == 42 )
+        && ( mapped( TDomain3::Point( 2047, 2047, 1023 - 512 ) ) == 0 );
+    }
+  catch ( DGtal::IOException & e )
+    {
+      ok = false;
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "nbValues == 2^32, last value == 42" << std::endl;
+
+  // One more slice needs 2^32 + 2^22 bytes.
+  bool caught = false;
+  try
+    {
+      RawReader<Image>::importRaw8Mapped( filename, Vector3( 2048, 2048, 1025 ) );
+    }
+  catch ( DGtal::IOException & e )
+    {
+      caught = true;
+    }
+  nbok += caught ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "IOException on a too short file" << std::endl;
+  std::remove( filename.c_str() );
+#endif
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -113,7 +252,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testRawReader2D(); // && ... other tests
+  bool res = testRawReader2D() && testRawReaderMapped()
+    && testRawReaderMappedLarge(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,213 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSlabReader.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class SlabReader.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <stdexcept>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByBricks.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/SlabReader.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+  << #x << std::endl;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+
+/**
+ * Consumer checking each slab against the whole image and counting
+ * the core voxels.
+ */
+struct SlabChecker
+{
+  SlabChecker( const Image & anImage ) : image( anImage ), nbCore( 0 ), nbErrors( 0 ) {}
+
+  template <typename TSlab>
+  void operator()( const TSlab & slab, const Z3i::Domain & core )
+  {
+    for ( Z3i::Domain::ConstIterator it = slab.domain().begin(),
+            itE = slab.domain().end(); it != itE; ++it )
+      if ( slab( *it ) != image( *it ) ) ++nbErrors;
+    nbCore += core.size();
+  }
+
+  const Image & image;
+  unsigned int nbCore;
+  unsigned int nbErrors;
+};
+
+/**
+ * Consumer throwing on its second slab.
+ */
+struct ThrowingConsumer
+{
+  ThrowingConsumer() : nbCalls( 0 ) {}
+
+  template <typename TSlab>
+  void operator()( const TSlab &, const Z3i::Domain & )
+  {
+    if ( ++nbCalls == 2 ) throw std::runtime_error( "second slab" );
+  }
+
+  unsigned int nbCalls;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SlabReader.
+///////////////////////////////////////////////////////////////////////////////
+
+bool testSlabs()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Testing SlabReader::readSlab on a Vol file" );
+  std::string filename = testPath + "samples/cat10.vol";
+  Image image = VolReader<Image>::importVol( filename );
+  DGtal::uint64_t offset;
+  Z3i::Domain domain = VolReader<Image>::importVolDomain( filename, offset );
+  INBLOCK_TEST( domain.lowerBound() == image.domain().lowerBound()
+                && domain.upperBound() == image.domain().upperBound() );
+
+  SlabReader<Image> reader( filename, domain, offset, 3, 1 );
+  trace.info() << reader << std::endl;
+  const int depth = domain.upperBound()[ 2 ] - domain.lowerBound()[ 2 ] + 1;
+  INBLOCK_TEST( reader.isValid() && reader.nbSlabs() == ( depth + 2 ) / 3 );
+  INBLOCK_TEST( reader.slabDomain( 0 ).lowerBound()[ 2 ] == domain.lowerBound()[ 2 ]
+                && reader.slabDomain( 0 ).upperBound()[ 2 ] == domain.lowerBound()[ 2 ] + 3 );
+  INBLOCK_TEST( reader.slabDomain( reader.nbSlabs() - 1 ).upperBound()[ 2 ]
+                == domain.upperBound()[ 2 ] );
+
+  unsigned int nbErrors = 0;
+  for ( int i = 0; i < reader.nbSlabs(); ++i )
+    {
+      Image * slab = reader.readSlab( i );
+      if ( slab->domain().lowerBound() != reader.slabDomain( i ).lowerBound()
+           || slab->domain().upperBound() != reader.slabDomain( i ).upperBound() )
+        ++nbErrors;
+      for ( Image::Domain::ConstIterator it = slab->domain().begin(),
+              itE = slab->domain().end(); it != itE; ++it )
+        if ( (*slab)( *it ) != image( *it ) ) ++nbErrors;
+      delete slab;
+    }
+  INBLOCK_TEST( nbErrors == 0 );
+
+  // Generic (setValue) filling.
+  typedef ImageContainerByBricks<Z3i::Domain, unsigned int> BrickImage;
+  SlabReader<BrickImage> brickReader( filename, domain, offset, 4 );
+  BrickImage * brickSlab = brickReader.readSlab( 1 );
+  nbErrors = 0;
+  for ( Image::Domain::ConstIterator it = brickSlab->domain().begin(),
+          itE = brickSlab->domain().end(); it != itE; ++it )
+    if ( (*brickSlab)( *it ) != image( *it ) ) ++nbErrors;
+  INBLOCK_TEST( nbErrors == 0 && brickSlab->domain().size() == 4 * domain.size() / depth );
+  delete brickSlab;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testProcess()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Testing SlabReader::process" );
+  std::string filename = testPath + "samples/lobsterCroped.vol";
+  Image image = VolReader<Image>::importVol( filename );
+  DGtal::uint64_t offset;
+  Z3i::Domain domain = VolReader<Image>::importVolDomain( filename, offset );
+
+  SlabReader<Image> reader( filename, domain, offset, 7, 2 );
+  SlabChecker checker( image );
+  reader.process( checker );
+  INBLOCK_TEST( checker.nbErrors == 0 );
+  INBLOCK_TEST( checker.nbCore == domain.size() );
+
+  bool thrown = false;
+  try
+    {
+      // Wrong offset: the last slab can't be read.
+      SlabReader<Image> shortReader( filename, domain, offset + 1, 7, 2 );
+      SlabChecker shortChecker( image );
+      shortReader.process( shortChecker );
+    }
+  catch ( DGtal::IOException & )
+    {
+      thrown = true;
+    }
+  INBLOCK_TEST( thrown );
+
+  // The consumer exception is thrown again by process.
+  std::string message;
+  ThrowingConsumer throwing;
+  try
+    {
+      reader.process( throwing );
+    }
+  catch ( std::runtime_error & e )
+    {
+      message = e.what();
+    }
+  trace.info() << "message=" << message << std::endl;
+  INBLOCK_TEST( throwing.nbCalls == 2 && message.find( "second slab" ) != std::string::npos );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SlabReader" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testSlabs()
+    && testProcess();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -169,6 +169,80 @@ bool testConsistence()
   return true;
 }
 
+bool testVolMapped()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing VolReader::importVolMapped ..." );
+
+  typedef SpaceND<3> Space4Type;
+  typedef HyperRectDomain<Space4Type> TDomain;
+  typedef TDomain::Point Point;
+  typedef ImageSelector<TDomain, unsigned char>::Type Image;
+  typedef VolReader<Image>::MappedImage MappedImage;
+
+  std::string filename = testPath + "samples/cat10.vol";
+  Image image = VolReader<Image>::importVol( filename );
+  MappedImage mapped = VolReader<Image>::importVolMapped( filename );
+  trace.info() << mapped << endl;
+
+  bool same = ( mapped.domain().lowerBound() == image.domain().lowerBound()
+                && mapped.domain().upperBound() == image.domain().upperBound() );
+  for ( TDomain::ConstIterator it = image.domain().begin(), itend = image.domain().end();
+        same && it != itend; ++it )
+    same = ( mapped( *it ) == image( *it ) );
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mapped values == imported values" << std::endl;
+
+  // Centered domain.
+  TDomain domain( Point( -17, -14, -13 ), Point( 5, 7, 11 ) );
+  Image image2( domain );
+  for ( TDomain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+    image2.setValue( *it, (unsigned char)( (*it)[ 0 ] + 3 * (*it)[ 1 ] + 7 * (*it)[ 2 ] ) );
+  VolWriter<Image>::exportVol( "testVolMapped.vol", image2 );
+  MappedImage mapped2 = VolReader<Image>::importVolMapped( "testVolMapped.vol",
+                                                            MappedImage::COPY_ON_WRITE );
+  same = ( mapped2.domain().lowerBound() == domain.lowerBound()
+           && mapped2.domain().upperBound() == domain.upperBound() );
+  for ( TDomain::ConstIterator it = domain.begin(), itend = domain.end();
+        same && it != itend; ++it )
+    same = ( mapped2( *it ) == image2( *it ) );
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mapped values == written values (centered domain)" << std::endl;
+
+  // Copy-on-write: the file is left untouched.
+  const Point p( 1, 2, 3 );
+  mapped2.setValue( p, 255 );
+  MappedImage mapped3 = VolReader<Image>::importVolMapped( "testVolMapped.vol" );
+  nbok += ( mapped2( p ) == 255 && mapped3( p ) == image2( p ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "copy-on-write does not modify the file" << std::endl;
+
+  // Errors
+  bool caught = false;
+  try
+    {
+      VolReader<Image>::importVolMapped( "NoFileHere.vol" );
+    }
+  catch ( DGtal::IOException & e )
+    {
+      caught = true;
+    }
+  nbok += caught ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "IOException on a missing file" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -183,7 +257,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testVolReader() && testIOException() && testConsistence(); // && ... other tests
+  bool res = testVolReader() && testIOException() && testConsistence()
+    && testVolMapped(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -79,6 +79,18 @@ bool testLongvol()
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") "
          << "true == true" << std::endl;
+
+  LongvolReader<Image>::MappedImage mapped =
+    LongvolReader<Image>::importLongvolMapped("export-longvol.longvol");
+  trace.info() << mapped << std::endl;
+  bool sameValues = ( mapped.domain().upperBound() == b );
+  for(Z3i::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end();
+      sameValues && it != itend; ++it)
+    sameValues = ( mapped( *it ) == image( *it ) );
+  nbok += sameValues ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "mapped values == written values" << std::endl;
   trace.endBlock();
   
   return nbok == nb;
@@ -44,6 +44,7 @@
 #include "DGtal/io/writers/PGMWriter.h"
 #include "DGtal/io/writers/PPMWriter.h"
 #include "DGtal/io/readers/PGMReader.h"
+#include "DGtal/io/readers/PPMReader.h"
 #include "DGtal/io/writers/RawWriter.h"
 #include "DGtal/io/boards/Board2D.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -150,6 +151,32 @@ bool testRWIssue254()
   return ok;
 }
 
+bool testPPMBinaryWriter()
+{
+  trace.beginBlock ( "Testing binary PPM Writer ..." );
+
+  typedef SpaceND<2> TSpace;
+  typedef TSpace::Point Point;
+  typedef HyperRectDomain<TSpace> Domain;
+  typedef GrayscaleColorMap<unsigned char> Gray;
+  typedef ImageSelector<Domain, unsigned char>::Type Image;
+
+  Domain domain( Point( -3, 2 ), Point( 9, 8 ) );
+  Image image( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    image.setValue( *it, (unsigned char)( 11 * (*it)[ 0 ] + 37 * (*it)[ 1 ] ) );
+
+  PPMWriter<Image, Gray>::exportPPM( "export-gray-binary.ppm", image, Gray( 0, 255 ), true, false );
+  Image imageRead = PPMReader<Image, functors::RedChannel>::importPPM( "export-gray-binary.ppm",
+                                                                       functors::RedChannel() );
+  bool ok = true;
+  for ( Domain::ConstIterator it = domain.begin(); ok && it != domain.end(); ++it )
+    ok = ( image( *it ) == imageRead( *it - domain.lowerBound() ) );
+  trace.info() << "P6 written == P6 read: " << ok << std::endl;
+  trace.endBlock();
+  return ok;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -161,7 +188,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << std::endl;
   
-  bool res = testPNMWriter() && testRWIssue254(); // && ... other tests
+  bool res = testPNMWriter() && testRWIssue254() && testPPMBinaryWriter(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,217 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSlabWriter.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class SlabWriter.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/readers/RawReader.h"
+#include "DGtal/io/readers/SlabReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/writers/SlabWriter.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+  << #x << std::endl;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned int> LImage;
+
+/**
+ * Consumer computing, on the core of each slab, the maximum of each
+ * voxel and of its two Z-neighbors, and writing it.
+ */
+struct MaxFilter
+{
+  MaxFilter( SlabWriter<Image> & aWriter ) : writer( aWriter ) {}
+
+  void operator()( const Image & slab, const Z3i::Domain & core )
+  {
+    Image result( core );
+    for ( Z3i::Domain::ConstIterator it = core.begin(), itE = core.end(); it != itE; ++it )
+      result.setValue( *it, maxZ( slab, *it ) );
+    writer.writeSlab( result );
+  }
+
+  static unsigned char maxZ( const Image & image, const Z3i::Point & p )
+  {
+    unsigned char v = image( p );
+    for ( int dz = -1; dz <= 1; dz += 2 )
+      {
+        Z3i::Point q = p + Z3i::Point( 0, 0, dz );
+        if ( image.domain().isInside( q ) )
+          v = std::max( v, image( q ) );
+      }
+    return v;
+  }
+
+  SlabWriter<Image> & writer;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SlabWriter.
+///////////////////////////////////////////////////////////////////////////////
+
+bool testWriteFormats()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Testing SlabWriter formats" );
+  Z3i::Domain domain( Z3i::Point( -3, 1, 2 ), Z3i::Point( 5, 7, 12 ) );
+  LImage image( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    image.setValue( *it, (*it)[ 0 ] + 10 * (*it)[ 1 ] + 1000 * (*it)[ 2 ] + 100000 );
+
+  // Longvol, written by slabs of 4 planes.
+  {
+    SlabWriter<LImage, DGtal::uint64_t> writer( "testSlabWriter.longvol", domain,
+                                                SlabWriter<LImage, DGtal::uint64_t>::LONGVOL );
+    trace.info() << writer << std::endl;
+    for ( int z = domain.lowerBound()[ 2 ]; z <= domain.upperBound()[ 2 ]; z += 4 )
+      {
+        Z3i::Point low = domain.lowerBound(), up = domain.upperBound();
+        low[ 2 ] = z;
+        up[ 2 ] = std::min( z + 3, up[ 2 ] );
+        writer.writeSlab( image, Z3i::Domain( low, up ) );
+      }
+    INBLOCK_TEST( writer.isComplete() );
+    writer.close();
+  }
+  LImage longvol = LongvolReader<LImage>::importLongvol( "testSlabWriter.longvol" );
+  unsigned int nbErrors = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( longvol( *it ) != image( *it ) ) ++nbErrors;
+  INBLOCK_TEST( nbErrors == 0 );
+
+  // Raw 32 bits, written in one slab.
+  {
+    SlabWriter<LImage, DGtal::uint32_t> writer( "testSlabWriter.raw", domain );
+    writer.writeSlab( image );
+    writer.close();
+  }
+  LImage raw = RawReader<LImage>::importRaw32( "testSlabWriter.raw",
+                                               domain.upperBound() - domain.lowerBound()
+                                               + Z3i::Point::diagonal( 1 ) );
+  nbErrors = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itR = raw.domain().begin();
+        it != domain.end(); ++it, ++itR )
+    if ( raw( *itR ) != image( *it ) ) ++nbErrors;
+  INBLOCK_TEST( nbErrors == 0 );
+
+  // Incomplete file.
+  bool thrown = false;
+  try
+    {
+      SlabWriter<LImage, DGtal::uint32_t> writer( "testSlabWriter.raw", domain );
+      writer.close();
+    }
+  catch ( DGtal::IOException & )
+    {
+      thrown = true;
+    }
+  INBLOCK_TEST( thrown );
+
+  // Values too large for a Vol file.
+  thrown = false;
+  try
+    {
+      SlabWriter<LImage, DGtal::uint32_t> writer( "testSlabWriter.vol", domain,
+                                                  SlabWriter<LImage, DGtal::uint32_t>::VOL );
+    }
+  catch ( DGtal::IOException & )
+    {
+      thrown = true;
+    }
+  INBLOCK_TEST( thrown );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testPipeline()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Testing a streaming Vol filter" );
+  std::string filename = testPath + "samples/cat10.vol";
+  Image image = VolReader<Image>::importVol( filename );
+  DGtal::uint64_t offset;
+  Z3i::Domain domain = VolReader<Image>::importVolDomain( filename, offset );
+
+  {
+    SlabReader<Image> reader( filename, domain, offset, 3, 1 );
+    SlabWriter<Image> writer( "testSlabWriter.vol", domain, SlabWriter<Image>::VOL );
+    MaxFilter filter( writer );
+    reader.process( filter );
+    INBLOCK_TEST( writer.isComplete() );
+  }
+
+  Image result = VolReader<Image>::importVol( "testSlabWriter.vol" );
+  unsigned int nbErrors = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( result( *it ) != MaxFilter::maxZ( image, *it ) ) ++nbErrors;
+  INBLOCK_TEST( nbErrors == 0 );
+  INBLOCK_TEST( result.domain().lowerBound() == domain.lowerBound()
+                && result.domain().upperBound() == domain.upperBound() );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SlabWriter" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testWriteFormats()
+    && testPipeline();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,221 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSetByBitVector.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class DigitalSetByBitVector.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <boost/type_traits/is_same.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+  << #x << std::endl;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSetByBitVector.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return 'true' iff both sets have the same points.
+template <typename TSet1, typename TSet2>
+bool sameSets( const TSet1 & s1, const TSet2 & s2 )
+{
+  typedef typename TSet1::Point Point;
+  std::vector<Point> v1( s1.begin(), s1.end() );
+  std::vector<Point> v2( s2.begin(), s2.end() );
+  std::sort( v1.begin(), v1.end() );
+  std::sort( v2.begin(), v2.end() );
+  return ( s1.size() == v1.size() ) && ( s2.size() == v2.size() ) && ( v1 == v2 );
+}
+
+bool testBasicServices()
+{
+  using namespace Z3i;
+  typedef DigitalSetByBitVector<Domain> BitSet;
+  BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< BitSet > ));
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing insert/find/erase/iterators." );
+  // 5 x 7 x 3 = 105 points, so that the last word is partially used.
+  Domain domain( Point( -2, -3, 1 ), Point( 2, 3, 3 ) );
+  BitSet S( domain );
+  INBLOCK_TEST( S.empty() && S.size() == 0 && S.begin() == S.end() );
+  S.insert( Point( 0, 0, 2 ) );
+  S.insert( Point( 2, 3, 3 ) );
+  S.insert( Point( -2, -3, 1 ) );
+  S.insert( Point( 0, 0, 2 ) );
+  INBLOCK_TEST( S.size() == 3 );
+  INBLOCK_TEST( S( Point( 0, 0, 2 ) ) && ! S( Point( 1, 0, 2 ) ) );
+  INBLOCK_TEST( ! S( Point( 10, 0, 2 ) ) && S.find( Point( 10, 0, 2 ) ) == S.end() );
+  INBLOCK_TEST( *S.find( Point( 2, 3, 3 ) ) == Point( 2, 3, 3 ) );
+  INBLOCK_TEST( *S.begin() == Point( -2, -3, 1 ) );
+  BitSet::ConstIterator it = S.end();
+  --it;
+  INBLOCK_TEST( *it == Point( 2, 3, 3 ) );
+  --it;
+  INBLOCK_TEST( *it == Point( 0, 0, 2 ) );
+  INBLOCK_TEST( S.erase( Point( 0, 0, 2 ) ) == 1 && S.erase( Point( 0, 0, 2 ) ) == 0 );
+  S.erase( S.begin() );
+  INBLOCK_TEST( S.size() == 1 && *S.begin() == Point( 2, 3, 3 ) );
+  trace.info() << S << std::endl;
+
+  // Iteration order is the domain order.
+  DigitalSetBySTLSet<Domain> R( domain );
+  BitSet B( domain );
+  std::vector<Point> inserted;
+  unsigned int i = 0;
+  for ( Domain::ConstIterator p = domain.begin(); p != domain.end(); ++p, ++i )
+    if ( ( i * 7 ) % 5 < 2 )
+      {
+        R.insert( *p );
+        B.insert( *p );
+        inserted.push_back( *p );
+      }
+  INBLOCK_TEST( sameSets( B, R ) );
+  INBLOCK_TEST( std::equal( inserted.begin(), inserted.end(), B.begin() ) );
+  Point lo1, up1, lo2, up2;
+  B.computeBoundingBox( lo1, up1 );
+  R.computeBoundingBox( lo2, up2 );
+  INBLOCK_TEST( lo1 == lo2 && up1 == up2 );
+  std::vector<Point> backward;
+  for ( BitSet::ConstIterator itB = B.end(); itB != B.begin(); )
+    backward.push_back( *--itB );
+  INBLOCK_TEST( std::equal( backward.rbegin(), backward.rend(), B.begin() ) );
+  B.clear();
+  INBLOCK_TEST( B.empty() && B.begin() == B.end() && B.isValid() );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testSetOperations()
+{
+  using namespace Z2i;
+  typedef DigitalSetByBitVector<Domain> BitSet;
+  typedef DigitalSetBySTLSet<Domain> RefSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing union/intersection/difference/complement." );
+  Domain domain( Point( -10, -10 ), Point( 10, 10 ) );
+  BitSet A( domain ), B( domain );
+  RefSet rA( domain ), rB( domain );
+  for ( Domain::ConstIterator p = domain.begin(); p != domain.end(); ++p )
+    {
+      if ( (*p).norm() <= 7.0 ) { A.insert( *p ); rA.insert( *p ); }
+      if ( (*p)[ 0 ] + (*p)[ 1 ] >= 2 ) { B.insert( *p ); rB.insert( *p ); }
+    }
+
+  BitSet U( A ); U += B;
+  RefSet rU( rA ); rU += rB;
+  INBLOCK_TEST( sameSets( U, rU ) );
+
+  BitSet I( A ); I &= B;
+  RefSet rI( domain );
+  for ( RefSet::ConstIterator it = rA.begin(); it != rA.end(); ++it )
+    if ( rB( *it ) ) rI.insert( *it );
+  INBLOCK_TEST( sameSets( I, rI ) );
+
+  BitSet D( A ); D -= B;
+  RefSet rD( domain );
+  for ( RefSet::ConstIterator it = rA.begin(); it != rA.end(); ++it )
+    if ( ! rB( *it ) ) rD.insert( *it );
+  INBLOCK_TEST( sameSets( D, rD ) );
+
+  BitSet C( domain );
+  C.assignFromComplement( A );
+  RefSet rC( domain );
+  rC.assignFromComplement( rA );
+  INBLOCK_TEST( sameSets( C, rC ) );
+  INBLOCK_TEST( C.size() + A.size() == domain.size() );
+
+  std::vector<Point> comp;
+  std::back_insert_iterator< std::vector<Point> > ito( comp );
+  A.computeComplement( ito );
+  INBLOCK_TEST( comp.size() == rC.size()
+                && std::equal( comp.begin(), comp.end(), C.begin() ) );
+
+  // Sets with different domains fall back to point-wise operations.
+  BitSet E( Domain( Point( 0, 0 ), Point( 20, 20 ) ) );
+  E.insert( Point( 3, 3 ) );
+  E.insert( Point( 15, 15 ) );
+  BitSet F( A ); F -= E;
+  INBLOCK_TEST( F.size() == A.size() - 1 && ! F( Point( 3, 3 ) ) );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testSelector()
+{
+  using namespace Z3i;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing DigitalSetSelector." );
+  typedef DigitalSetSelector< Domain, WHOLE_DS+HIGH_BEL_DS >::Type Set1;
+  typedef DigitalSetSelector< Domain, WHOLE_DS+HIGH_ITER_DS+HIGH_BEL_DS >::Type Set2;
+  typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type Set3;
+  INBLOCK_TEST( ( boost::is_same< Set1, DigitalSetByBitVector<Domain> >::value ) );
+  INBLOCK_TEST( ( boost::is_same< Set2, DigitalSetByBitVector<Domain> >::value ) );
+  INBLOCK_TEST( ( boost::is_same< Set3, DigitalSetBySTLSet<Domain> >::value ) );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DigitalSetByBitVector" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBasicServices()
+    && testSetOperations()
+    && testSelector();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
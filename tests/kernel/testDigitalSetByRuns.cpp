@@ -0,0 +1,203 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSetByRuns.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class DigitalSetByRuns.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByRuns.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+  << #x << std::endl;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSetByRuns.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return 'true' iff both sets have the same points.
+template <typename TSet1, typename TSet2>
+bool sameSets( const TSet1 & s1, const TSet2 & s2 )
+{
+  typedef typename TSet1::Point Point;
+  std::vector<Point> v1( s1.begin(), s1.end() );
+  std::vector<Point> v2( s2.begin(), s2.end() );
+  std::sort( v1.begin(), v1.end() );
+  std::sort( v2.begin(), v2.end() );
+  return ( s1.size() == v1.size() ) && ( s2.size() == v2.size() ) && ( v1 == v2 );
+}
+
+bool testBasicServices()
+{
+  using namespace Z3i;
+  typedef DigitalSetByRuns<Domain> RunSet;
+  BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< RunSet > ));
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing insert/find/erase/iterators." );
+  Domain domain( Point( -5, -2, 0 ), Point( 5, 2, 2 ) );
+  RunSet S( domain );
+  INBLOCK_TEST( S.empty() && S.begin() == S.end() );
+  S.insert( Point( 0, 0, 1 ) );
+  S.insert( Point( 2, 0, 1 ) );
+  INBLOCK_TEST( S.size() == 2 && S.nbRuns() == 2 );
+  S.insert( Point( 1, 0, 1 ) );
+  INBLOCK_TEST( S.size() == 3 && S.nbRuns() == 1 );
+  S.insert( Point( 1, 0, 1 ) );
+  INBLOCK_TEST( S.size() == 3 && S( Point( 2, 0, 1 ) ) && ! S( Point( 3, 0, 1 ) ) );
+  INBLOCK_TEST( S.erase( Point( 1, 0, 1 ) ) == 1 && S.nbRuns() == 2 && S.size() == 2 );
+  S.insertRun( Point( 0, 1, 2 ), -5, 5 );
+  INBLOCK_TEST( S.size() == 13 && S.nbRuns() == 3 );
+  INBLOCK_TEST( *S.find( Point( 4, 1, 2 ) ) == Point( 4, 1, 2 )
+                && S.find( Point( 4, 0, 2 ) ) == S.end() );
+  RunSet::ConstIterator it = S.end();
+  --it;
+  INBLOCK_TEST( *it == Point( 5, 1, 2 ) );
+  S.erase( S.begin() );
+  INBLOCK_TEST( S.size() == 12 && *S.begin() == Point( 2, 0, 1 ) );
+  INBLOCK_TEST( S.isValid() );
+  trace.info() << S << std::endl;
+
+  // Random insertions and removals against a reference set.
+  srand( 0 );
+  RunSet R( domain );
+  DigitalSetBySTLSet<Domain> Ref( domain );
+  std::vector<Point> inOrder;
+  for ( unsigned int i = 0; i < 2000; ++i )
+    {
+      Point p( rand() % 11 - 5, rand() % 5 - 2, rand() % 3 );
+      if ( rand() % 3 ) { R.insert( p ); Ref.insert( p ); }
+      else              { R.erase( p ); Ref.erase( p ); }
+    }
+  INBLOCK_TEST( sameSets( R, Ref ) && R.isValid() );
+  for ( Domain::ConstIterator p = domain.begin(); p != domain.end(); ++p )
+    if ( Ref( *p ) ) inOrder.push_back( *p );
+  INBLOCK_TEST( std::equal( inOrder.begin(), inOrder.end(), R.begin() ) );
+  std::vector<Point> backward;
+  for ( RunSet::ConstIterator itR = R.end(); itR != R.begin(); )
+    backward.push_back( *--itR );
+  INBLOCK_TEST( std::equal( backward.rbegin(), backward.rend(), inOrder.begin() ) );
+  Point lo1, up1, lo2, up2;
+  R.computeBoundingBox( lo1, up1 );
+  Ref.computeBoundingBox( lo2, up2 );
+  INBLOCK_TEST( lo1 == lo2 && up1 == up2 );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testSetOperations()
+{
+  using namespace Z2i;
+  typedef DigitalSetByRuns<Domain> RunSet;
+  typedef DigitalSetBySTLSet<Domain> RefSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing union/intersection/difference/complement." );
+  Domain domain( Point( -20, -20 ), Point( 20, 20 ) );
+  RunSet A( domain ), B( domain );
+  RefSet rA( domain ), rB( domain );
+  for ( Domain::ConstIterator p = domain.begin(); p != domain.end(); ++p )
+    {
+      const Point & q = *p;
+      if ( ( q.norm() <= 15.0 ) && ( q.norm() >= 5.0 ) ) { A.insert( q ); rA.insert( q ); }
+      if ( ( ( q[ 0 ] + 20 ) / 3 ) % 2 == 0 )              { B.insert( q ); rB.insert( q ); }
+    }
+  trace.info() << A << " " << B << std::endl;
+
+  RunSet U( A ); U += B;
+  RefSet rU( rA ); rU += rB;
+  INBLOCK_TEST( sameSets( U, rU ) && U.isValid() );
+
+  RunSet I( A ); I &= B;
+  RefSet rI( domain );
+  for ( RefSet::ConstIterator it = rA.begin(); it != rA.end(); ++it )
+    if ( rB( *it ) ) rI.insert( *it );
+  INBLOCK_TEST( sameSets( I, rI ) && I.isValid() );
+
+  RunSet D( A ); D -= B;
+  RefSet rD( domain );
+  for ( RefSet::ConstIterator it = rA.begin(); it != rA.end(); ++it )
+    if ( ! rB( *it ) ) rD.insert( *it );
+  INBLOCK_TEST( sameSets( D, rD ) && D.isValid() );
+
+  RunSet C( domain );
+  C.assignFromComplement( A );
+  RefSet rC( domain );
+  rC.assignFromComplement( rA );
+  INBLOCK_TEST( sameSets( C, rC ) && C.isValid() );
+
+  std::vector<Point> comp;
+  std::back_insert_iterator< std::vector<Point> > ito( comp );
+  A.computeComplement( ito );
+  INBLOCK_TEST( comp.size() == C.size()
+                && std::equal( comp.begin(), comp.end(), C.begin() ) );
+
+  // Sets with different domains fall back to point-wise operations.
+  RunSet E( Domain( Point( 0, 0 ), Point( 30, 30 ) ) );
+  E.insert( Point( 10, 0 ) );
+  E.insert( Point( 25, 25 ) );
+  RunSet F( A ); F -= E;
+  INBLOCK_TEST( F.size() == A.size() - 1 && ! F( Point( 10, 0 ) ) );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DigitalSetByRuns" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBasicServices()
+    && testSetOperations();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
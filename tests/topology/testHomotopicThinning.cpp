@@ -0,0 +1,229 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHomotopicThinning.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class HomotopicThinning.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/SimplicityTable.h"
+#include "DGtal/topology/HomotopicThinning.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class HomotopicThinning.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Priority: distance to the origin.
+template <typename TPoint>
+struct NormPriority
+{
+  typedef double Value;
+  double operator()( const TPoint & p ) const { return p.norm(); }
+};
+
+/// Fixed points: the points on the first axis.
+template <typename TPoint>
+struct OnFirstAxis
+{
+  bool operator()( const TPoint & p ) const
+  {
+    for ( Dimension i = 1; i < TPoint::dimension; ++i )
+      if ( p[ i ] != 0 ) return false;
+    return true;
+  }
+};
+
+/// @return the number of connected components of the object and of its complement in the domain.
+template <typename TObject>
+std::pair<unsigned int, unsigned int> nbComponents( const TObject & obj )
+{
+  typedef typename TObject::DigitalSet DigitalSet;
+  typedef typename TObject::Domain Domain;
+  typedef typename TObject::ComplementObject ComplementObject;
+  std::vector<TObject> objects;
+  std::back_insert_iterator< std::vector<TObject> > it( objects );
+  unsigned int nb = obj.writeComponents( it );
+  DigitalSet comp( obj.domain() );
+  for ( typename Domain::ConstIterator p = obj.domain().begin(),
+          pE = obj.domain().end(); p != pE; ++p )
+    if ( ! obj.pointSet()( *p ) ) comp.insertNew( *p );
+  ComplementObject cobj( obj.topology().reverseTopology(), comp );
+  std::vector<ComplementObject> cobjects;
+  std::back_insert_iterator< std::vector<ComplementObject> > cit( cobjects );
+  unsigned int nbc = cobj.writeComponents( cit );
+  return std::make_pair( nb, nbc );
+}
+
+/// @return 'true' iff no point of the object is simple, except fixed points.
+template <typename TObject, typename TFixedPredicate>
+bool isThin( const TObject & obj, const TFixedPredicate & fixed )
+{
+  for ( typename TObject::ConstIterator it = obj.begin(), itE = obj.end();
+        it != itE; ++it )
+    if ( ! fixed( *it ) && obj.isSimple( *it ) ) return false;
+  return true;
+}
+
+template <typename TObject, typename TFixedPredicate>
+bool containsFixed( const TObject & obj, const typename TObject::DigitalSet & S,
+                    const TFixedPredicate & fixed )
+{
+  for ( typename TObject::DigitalSet::ConstIterator it = S.begin(), itE = S.end();
+        it != itE; ++it )
+    if ( fixed( *it ) && ! obj.pointSet()( *it ) ) return false;
+  return true;
+}
+
+bool testHomotopicThinning2D()
+{
+  using namespace Z2i;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing homotopic thinning of a 2D annulus." );
+  Domain domain( Point( -12, -12 ), Point( 12, 12 ) );
+  DigitalSet annulus( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( ( (*it).norm() <= 10.0 ) && ( (*it).norm() >= 4.0 ) )
+      annulus.insertNew( *it );
+  Object8_4 shape( dt8_4, annulus );
+  std::pair<unsigned int, unsigned int> cc = nbComponents( shape );
+  trace.info() << "Annulus: " << annulus.size() << " points, "
+               << cc.first << " / " << cc.second << " components." << std::endl;
+
+  Object8_4 shape1( dt8_4, annulus );
+  HomotopicThinning<Object8_4> thinning1( shape1 );
+  Object8_4::Size n1 = thinning1.thin();
+  trace.info() << thinning1 << " removed " << n1 << std::endl;
+  nbok += ( isThin( shape1, functors::FalsePointPredicate<Point>() )
+            && ( nbComponents( shape1 ) == cc ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "lexicographic thinning is thin and homotopic." << std::endl;
+
+  Object8_4 shape2( dt8_4, annulus );
+  HomotopicThinning<Object8_4> thinning2( shape2 );
+  OnFirstAxis<Point> fixed;
+  thinning2.thin( fixed, NormPriority<Point>() );
+  nbok += ( isThin( shape2, fixed ) && ( nbComponents( shape2 ) == cc )
+            && containsFixed( shape2, annulus, fixed ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "ordered thinning with fixed points." << std::endl;
+
+  Object8_4 shape3( dt8_4, annulus );
+  HomotopicThinning<Object8_4> thinning3( shape3 );
+  thinning3.thinBySubfields( fixed );
+  nbok += ( isThin( shape3, fixed ) && ( nbComponents( shape3 ) == cc )
+            && containsFixed( shape3, annulus, fixed ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "thinning by subfields with fixed points." << std::endl;
+
+  SimplicityTable<DT8_4> table( dt8_4 );
+  table.init();
+  Object8_4 shape4( dt8_4, annulus );
+  shape4.setTable( table );
+  HomotopicThinning<Object8_4> thinning4( shape4 );
+  thinning4.thinBySubfields( fixed );
+  nbok += ( shape4.pointSet().size() == shape3.pointSet().size() )
+    && std::equal( shape4.begin(), shape4.end(), shape3.begin() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "thinning by subfields with simplicity table." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testHomotopicThinning3D()
+{
+  using namespace Z3i;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing homotopic thinning of a 3D ring." );
+  Domain domain( Point( -14, -14, -4 ), Point( 14, 14, 4 ) );
+  DigitalSet ring( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( ( (*it).norm() <= 12.0 ) && ( (*it).norm() >= 8.0 )
+         && ( (*it)[ 2 ] >= -2 ) && ( (*it)[ 2 ] <= 2 ) )
+      ring.insertNew( *it );
+  Object18_6 shape( dt18_6, ring );
+  std::pair<unsigned int, unsigned int> cc = nbComponents( shape );
+  trace.info() << "Ring: " << ring.size() << " points, "
+               << cc.first << " / " << cc.second << " components." << std::endl;
+
+  Object18_6 shape1( dt18_6, ring );
+  HomotopicThinning<Object18_6> thinning1( shape1 );
+  thinning1.thin( functors::FalsePointPredicate<Point>(), NormPriority<Point>() );
+  trace.info() << thinning1 << std::endl;
+  nbok += ( isThin( shape1, functors::FalsePointPredicate<Point>() )
+            && ( nbComponents( shape1 ) == cc ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "ordered thinning is thin and homotopic." << std::endl;
+
+  Object18_6 shape2( dt18_6, ring );
+  HomotopicThinning<Object18_6> thinning2( shape2 );
+  thinning2.thinBySubfields();
+  trace.info() << thinning2 << std::endl;
+  nbok += ( isThin( shape2, functors::FalsePointPredicate<Point>() )
+            && ( nbComponents( shape2 ) == cc ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "thinning by subfields is thin and homotopic." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class HomotopicThinning" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testHomotopicThinning2D()
+    && testHomotopicThinning3D();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
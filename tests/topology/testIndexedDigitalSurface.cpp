@@ -0,0 +1,234 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIndexedDigitalSurface.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class IndexedDigitalSurface and its boost
+ * graph interface.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <set>
+#include <vector>
+#include <boost/graph/connected_components.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+#include "DGtal/graph/IndexedDigitalSurfaceBoostGraphInterface.h"
+#include "DGtal/graph/CUndirectedSimpleGraph.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::KSpace KSpace;
+typedef DigitalSetBoundary<KSpace, Z3i::DigitalSet> Container;
+typedef DigitalSurface<Container> Surface;
+typedef IndexedDigitalSurface<Container> IndexedSurface;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class IndexedDigitalSurface.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares an indexed digital surface with the digital surface it
+ * was built from.
+ */
+bool testIndexedDigitalSurface()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing IndexedDigitalSurface ..." );
+
+  BOOST_CONCEPT_ASSERT(( concepts::CUndirectedSimpleGraph<IndexedSurface> ));
+  const Z3i::Domain domain( Z3i::Point::diagonal( -12 ), Z3i::Point::diagonal( 12 ) );
+  Z3i::DigitalSet shape( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( shape, Z3i::Point( -4, 0, 0 ), 5 );
+  Shapes<Z3i::Domain>::addNorm2Ball( shape, Z3i::Point( 5, 1, 0 ), 4 );
+  Shapes<Z3i::Domain>::removeNorm2Ball( shape, Z3i::Point( -4, 0, 0 ), 2 );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  const Surface surface( new Container( K, shape, SurfelAdjacency<3>( true ) ) );
+  const IndexedSurface isurface( surface );
+  trace.info() << surface << " " << isurface << std::endl;
+  nbok += isurface.isValid() && ( isurface.size() == surface.size() ) ? 1 : 0;
+  nb++;
+
+  unsigned int nbErrors = 0;
+  for ( IndexedSurface::ConstIterator it = isurface.begin(), itE = isurface.end();
+        it != itE; ++it )
+    {
+      const IndexedSurface::Vertex v = *it;
+      const IndexedSurface::Surfel s = isurface.surfel( v );
+      std::vector<Surface::Vertex> neighbors;
+      std::back_insert_iterator< std::vector<Surface::Vertex> > outIt
+        = std::back_inserter( neighbors );
+      surface.writeNeighbors( outIt, s );
+      std::set<IndexedSurface::Vertex> ref, indexed;
+      for ( std::vector<Surface::Vertex>::const_iterator itn = neighbors.begin();
+            itn != neighbors.end(); ++itn )
+        ref.insert( isurface.vertex( *itn ) );
+      indexed.insert( isurface.beginNeighbors( v ), isurface.endNeighbors( v ) );
+      if ( ( isurface.vertex( s ) != v ) || ( isurface.degree( v ) != surface.degree( s ) )
+           || ( ref != indexed ) )
+        nbErrors++;
+    }
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same vertices, degrees and neighbors" << std::endl;
+
+  nbErrors = 0;
+  for ( IndexedSurface::Arc a = 0; a < isurface.nbArcs(); ++a )
+    {
+      const IndexedSurface::Arc b = isurface.opposite( a );
+      const Surface::Arc sa = isurface.surfaceArc( a );
+      if ( ( isurface.opposite( b ) != a ) || ( isurface.head( b ) != isurface.tail( a ) )
+           || ( isurface.arc( isurface.tail( a ), isurface.head( a ) ) != a )
+           || ( isurface.vertex( surface.head( sa ) ) != isurface.head( a ) )
+           || ( isurface.separator( a ) != surface.separator( sa ) ) )
+        nbErrors++;
+    }
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "opposite, head, tail and separator of arcs" << std::endl;
+
+  IndexedSurface::Size nbClosed = 0;
+  IndexedSurface::Size nbIncidences = 0;
+  for ( IndexedSurface::Face f = 0; f < isurface.nbFaces(); ++f )
+    {
+      nbClosed += isurface.isClosed( f ) ? 1 : 0;
+      nbIncidences += isurface.endVertices( f ) - isurface.beginVertices( f );
+    }
+  IndexedSurface::Size nbVertexFaces = 0;
+  for ( IndexedSurface::Vertex v = 0; v < isurface.size(); ++v )
+    nbVertexFaces += isurface.endFaces( v ) - isurface.beginFaces( v );
+  nbok += ( isurface.nbFaces() == surface.allFaces().size() )
+    && ( nbClosed == surface.allClosedFaces().size() )
+    && ( nbVertexFaces == nbIncidences ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "faces=" << isurface.nbFaces() << " closed=" << nbClosed << std::endl;
+
+  std::stringstream off, ioff;
+  surface.exportSurfaceAs3DOFF( off );
+  isurface.exportSurfaceAs3DOFF( ioff );
+  std::string line, iline;
+  std::getline( off, line ); std::getline( off, line );
+  std::getline( ioff, iline ); std::getline( ioff, iline );
+  nbok += ( std::string( std::istreambuf_iterator<char>( off ), std::istreambuf_iterator<char>() )
+            == std::string( std::istreambuf_iterator<char>( ioff ), std::istreambuf_iterator<char>() ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same OFF export" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Graph traversals over an indexed digital surface.
+ */
+bool testIndexedDigitalSurfaceTraversals()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing traversals of IndexedDigitalSurface ..." );
+
+  const Z3i::Domain domain( Z3i::Point::diagonal( -12 ), Z3i::Point::diagonal( 12 ) );
+  Z3i::DigitalSet shape( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( shape, Z3i::Point( -5, 0, 0 ), 4 );
+  Shapes<Z3i::Domain>::addNorm2Ball( shape, Z3i::Point( 5, 0, 0 ), 3 );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  const Surface surface( new Container( K, shape, SurfelAdjacency<3>( true ) ) );
+  const IndexedSurface isurface( surface );
+
+  // Two balls: two connected components, the first has the size of
+  // a breadth-first traversal from its first vertex.
+  typedef BreadthFirstVisitor<IndexedSurface> Visitor;
+  Visitor visitor( isurface, 0 );
+  IndexedSurface::Size nbVisited = 0;
+  unsigned int lastDistance = 0;
+  bool ordered = true;
+  while ( ! visitor.finished() )
+    {
+      ordered = ordered && ( visitor.current().second >= lastDistance );
+      lastDistance = visitor.current().second;
+      ++nbVisited;
+      visitor.expand();
+    }
+  std::vector<int> components( isurface.size() );
+  const int nbComponents = boost::connected_components( isurface, &components[ 0 ] );
+  IndexedSurface::Size nbFirst = 0;
+  for ( IndexedSurface::Vertex v = 0; v < isurface.size(); ++v )
+    nbFirst += ( components[ v ] == components[ 0 ] ) ? 1 : 0;
+  trace.info() << "visited=" << nbVisited << " components=" << nbComponents
+               << " first=" << nbFirst << std::endl;
+  nbok += ordered && ( nbComponents == 2 ) && ( nbVisited == nbFirst )
+    && ( nbVisited < isurface.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "BreadthFirstVisitor and boost::connected_components" << std::endl;
+
+  nbok += ( boost::num_edges( isurface ) == isurface.nbArcs() )
+    && ( boost::num_vertices( isurface ) == isurface.size() )
+    && ( boost::out_degree( 0, isurface ) == isurface.degree( 0 ) )
+    && ( boost::target( *boost::out_edges( 0, isurface ).first, isurface )
+         == *boost::adjacent_vertices( 0, isurface ).first ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "boost graph interface" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class IndexedDigitalSurface" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testIndexedDigitalSurface() && testIndexedDigitalSurfaceTraversals();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
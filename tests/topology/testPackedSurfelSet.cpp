@@ -0,0 +1,236 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedSurfelSet.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing classes KhalimskyCellKey, PackedSurfelSet
+ * and SortedVectorSet, and the hash-based cell sets of KhalimskySpaceND.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <set>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/SortedVectorSet.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/KhalimskyCellKey.h"
+#include "DGtal/topology/PackedSurfelSet.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::KSpace KSpace;
+typedef KSpace::SCell SCell;
+typedef KhalimskyCellKey<KSpace> CellKey;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedSurfelSet.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Batch construction and queries of SortedVectorSet.
+ */
+bool testSortedVectorSet()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing SortedVectorSet ..." );
+
+  std::vector<int> values;
+  for ( int i = 0; i < 1000; ++i )
+    values.push_back( rand() % 500 );
+  std::set<int> ref( values.begin(), values.end() );
+  SortedVectorSet<int> set( values.begin(), values.begin() + 500 );
+  set.insert( values.begin() + 500, values.end() );
+  trace.info() << set << std::endl;
+  nbok += set.isValid() && ( set.size() == ref.size() )
+    && std::equal( ref.begin(), ref.end(), set.begin() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "batch insertion == std::set" << std::endl;
+
+  nbok += ( set.insert( 1000 ).second ) && ( ! set.insert( 1000 ).second )
+    && ( set.count( 1000 ) == 1 ) && ( set.erase( 1000 ) == 1 )
+    && ( set.find( 1000 ) == set.end() ) && set.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "single insertion, search and removal" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Packing and unpacking of cells.
+ */
+bool testCellKey()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing KhalimskyCellKey ..." );
+
+  KSpace K;
+  K.init( Z3i::Point( -1000, -20, 3 ), Z3i::Point( 5000, 70, 3000 ), true );
+  const CellKey cellKey( K );
+  trace.info() << cellKey << std::endl;
+  nbok += cellKey.isValid() && ( cellKey.nbBits() == 14 + 8 + 13 + 1 ) ? 1 : 0;
+  nb++;
+
+  unsigned int nbErrors = 0;
+  for ( unsigned int i = 0; i < 10000; ++i )
+    {
+      const Z3i::Point kp( K.lowerCell().myCoordinates
+                           + Z3i::Point( rand() % 12003, rand() % 183, rand() % 5997 ) );
+      const SCell s = K.sCell( kp, ( i % 2 ) == 0 );
+      const KSpace::Cell c = K.unsigns( s );
+      if ( ( cellKey.sCell( cellKey.key( s ) ) != s )
+           || ( cellKey.cell( cellKey.key( c ) ) != c )
+           || ( cellKey.key( s ) >> 1 != cellKey.key( c ) ) )
+        nbErrors++;
+    }
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "key(cell) then cell(key) is the identity" << std::endl;
+
+  bool thrown = false;
+  try
+    {
+      KSpace K2;
+      K2.init( Z3i::Point::diagonal( -2000000 ), Z3i::Point::diagonal( 2000000 ), true );
+      CellKey tooBig( K2 );
+    }
+  catch ( InputException & )
+    {
+      thrown = true;
+    }
+  nbok += thrown ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "InputException when keys do not fit in 64 bits" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Tracks a boundary into several kinds of surfel sets.
+ */
+bool testSurfelSets()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing boundary tracking in surfel sets ..." );
+
+  const Z3i::Domain domain( Z3i::Point::diagonal( -12 ), Z3i::Point::diagonal( 12 ) );
+  Z3i::DigitalSet ball( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( ball, Z3i::Point::diagonal( 0 ), 8 );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  const SurfelAdjacency<3> SAdj( true );
+  const SCell bel = Surfaces<KSpace>::findABel( K, ball, 10000 );
+
+  typedef PackedSurfelSet<KSpace> HashedPackedSet;
+  typedef PackedSurfelSet<KSpace, SortedVectorSet<CellKey::Key> > SortedPackedSet;
+  KSpace::SurfelSet reference;
+  KSpace::SurfelHashSet hashed;
+  HashedPackedSet packed( K );
+  Surfaces<KSpace>::trackBoundary( reference, K, SAdj, ball, bel );
+  Surfaces<KSpace>::trackBoundary( hashed, K, SAdj, ball, bel );
+  Surfaces<KSpace>::trackBoundary( packed, K, SAdj, ball, bel );
+  SortedPackedSet sorted( K );
+  sorted.insert( reference.begin(), reference.end() );
+  trace.info() << "reference=" << reference.size() << " " << packed
+               << " " << sorted << std::endl;
+
+  unsigned int nbErrors = 0;
+  for ( KSpace::SurfelSet::const_iterator it = reference.begin(), itE = reference.end();
+        it != itE; ++it )
+    if ( ( hashed.count( *it ) != 1 ) || ( packed.find( *it ) == packed.end() )
+         || ( *packed.find( *it ) != *it ) || ( sorted.count( *it ) != 1 )
+         || ( sorted.count( K.sOpp( *it ) ) != 0 ) )
+      nbErrors++;
+  for ( HashedPackedSet::const_iterator it = packed.begin(), itE = packed.end();
+        it != itE; ++it )
+    if ( reference.count( *it ) != 1 )
+      nbErrors++;
+  nbok += ( nbErrors == 0 ) && ( hashed.size() == reference.size() )
+    && ( packed.size() == reference.size() ) && ( sorted.size() == reference.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "std::set == SurfelHashSet == PackedSurfelSet (hashed and sorted)" << std::endl;
+
+  //Digital surfaces over packed sets export the same surface.
+  typedef SetOfSurfels<KSpace, KSpace::SurfelSet> Reference;
+  typedef SetOfSurfels<KSpace, SortedPackedSet> Packed;
+  DigitalSurface<Reference> surface( new Reference( K, SAdj, reference ) );
+  DigitalSurface<Packed> packedSurface( new Packed( K, SAdj, sorted ) );
+  std::stringstream off, packedOff;
+  surface.exportSurfaceAs3DOFF( off );
+  packedSurface.exportSurfaceAs3DOFF( packedOff );
+  std::string header, packedHeader;
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      std::getline( off, header );
+      std::getline( packedOff, packedHeader );
+    }
+  trace.info() << "OFF " << header << " / " << packedHeader << std::endl;
+  nbok += ( packedSurface.size() == surface.size() ) && ( header == packedHeader ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "SetOfSurfels over a PackedSurfelSet" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PackedSurfelSet" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 0 );
+  bool res = testSortedVectorSet() && testCellKey() && testSurfelSets();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,122 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSimplicityTable-benchmark.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Benchmarks the homotopic thinning of homotopicThinning3D.cpp with
+ * geodesic neighborhoods (Object::isSimple) and with a precomputed
+ * SimplicityTable.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <queue>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/SimplicityTable.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The ring of homotopicThinning3D.cpp.
+ */
+DigitalSet makeRing( const Domain & domain )
+{
+  Point c( 0, 0, 0 );
+  DigitalSet shape_set( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      if ( ( (*it - c ).norm() <= 25 ) && ( (*it - c ).norm() >= 18 )
+           && ( ( ( (*it)[0] <= 3 ) && ( (*it)[0] >= -3 ) )
+                || ( ( (*it)[1] <= 3 ) && ( (*it)[1] >= -3 ) ) ) )
+        shape_set.insertNew( *it );
+    }
+  return shape_set;
+}
+
+/**
+ * The thinning loop of homotopicThinning3D.cpp.
+ * @return the number of points of the skeleton.
+ */
+Object18_6::Size thinning( Object18_6 & shape )
+{
+  int nb_simple = 0;
+  DigitalSet::Iterator it, itE;
+  do
+    {
+      DigitalSet & S = shape.pointSet();
+      std::queue<DigitalSet::Iterator> Q;
+      for ( it = S.begin(), itE = S.end(); it != itE; ++it )
+        if ( shape.isSimple( *it ) )
+          Q.push( it );
+      nb_simple = 0;
+      while ( ! Q.empty() )
+        {
+          DigitalSet::Iterator itt = Q.front();
+          Q.pop();
+          if ( shape.isSimple( *itt ) )
+            {
+              S.erase( *itt );
+              ++nb_simple;
+            }
+        }
+    }
+  while ( nb_simple != 0 );
+  return shape.size();
+}
+
+int main( int /*argc*/, char** /*argv*/ )
+{
+  Domain domain( Point( -50, -50, -50 ), Point( 50, 50, 50 ) );
+  DigitalSet shape_set = makeRing( domain );
+  trace.info() << "Ring has " << shape_set.size() << " points." << std::endl;
+
+  trace.beginBlock ( "Thinning with geodesic neighborhoods" );
+  Object18_6 shape( dt18_6, shape_set );
+  Object18_6::Size n1 = thinning( shape );
+  trace.info() << "Skeleton has " << n1 << " points." << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Computing simplicity table for (18,6) topology" );
+  SimplicityTable<DT18_6> table( dt18_6 );
+  table.init();
+  trace.info() << table << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Thinning with simplicity table" );
+  Object18_6 shape_table( dt18_6, shape_set );
+  shape_table.setTable( table );
+  Object18_6::Size n2 = thinning( shape_table );
+  trace.info() << "Skeleton has " << n2 << " points." << std::endl;
+  trace.endBlock();
+
+  return ( n1 == n2 ) ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,184 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSimplicityTable.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class SimplicityTable.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/SimplicityTable.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SimplicityTable.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Builds the object corresponding to configuration \a cfg around the
+ * origin and checks that Object::isSimple (geodesic neighborhoods)
+ * agrees with SimplicityTable::isSimpleConfiguration.
+ */
+template <typename TObject>
+bool checkConfiguration( const typename TObject::DigitalTopology & dt,
+                         const SimplicityTable<typename TObject::DigitalTopology> & table,
+                         typename TObject::Table::Configuration cfg )
+{
+  typedef typename TObject::Point Point;
+  typedef typename TObject::Domain Domain;
+  typedef typename Domain::ConstIterator ConstIterator;
+  const Point c = Point::diagonal( 0 );
+  Domain domain( Point::diagonal( -1 ), Point::diagonal( 1 ) );
+  TObject shape( dt, domain );
+  shape.pointSet().insert( c );
+  typename TObject::Table::Configuration mask = 1;
+  for ( ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( *it != c )
+      {
+        if ( cfg & mask ) shape.pointSet().insert( *it );
+        mask <<= 1;
+      }
+  return ( table.configuration( shape.pointSet(), c ) == cfg )
+    && ( shape.isSimple( c ) == table.isSimpleConfiguration( cfg ) );
+}
+
+template <typename TObject>
+bool testTable2D( const typename TObject::DigitalTopology & dt )
+{
+  typedef typename TObject::Table Table;
+  typedef typename TObject::Point Point;
+  typedef typename TObject::Domain Domain;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing 2D simplicity table." );
+  Table table( dt );
+  table.init();
+  trace.info() << table << std::endl;
+  nbok += table.isInitialized() && ( table.nbConfigurations() == 256 ) ? 1 : 0;
+  nb++;
+  for ( typename Table::Configuration cfg = 0; cfg < table.nbConfigurations(); ++cfg )
+    {
+      nbok += checkConfiguration<TObject>( dt, table, cfg )
+        && ( table( cfg ) == table.isSimpleConfiguration( cfg ) ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "all configurations agree with Object::isSimple." << std::endl;
+
+  std::stringstream buffer;
+  table.save( buffer );
+  Table table2( dt );
+  bool loaded = table2.load( buffer );
+  bool same = loaded;
+  for ( typename Table::Configuration cfg = 0; same && cfg < table.nbConfigurations(); ++cfg )
+    same = table( cfg ) == table2( cfg );
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "save/load round trip." << std::endl;
+
+  // Simplicity with or without table on a digital disk.
+  Domain domain( Point( -10, -10 ), Point( 10, 10 ) );
+  TObject disk( dt, domain );
+  for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( (*it).norm() <= 7.5 && ( (*it)[ 0 ] != 0 || (*it)[ 1 ] < 3 ) )
+      disk.pointSet().insert( *it );
+  TObject disk_table( disk );
+  disk_table.setTable( table );
+  bool agree = disk_table.hasTable() && ! disk.hasTable();
+  for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( disk.pointSet().find( *it ) != disk.pointSet().end() )
+      agree = agree && ( disk.isSimple( *it ) == disk_table.isSimple( *it ) );
+  nbok += agree ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Object::isSimple with and without table." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+template <typename TObject>
+bool testTable3D( const typename TObject::DigitalTopology & dt )
+{
+  typedef typename TObject::Table Table;
+  typedef typename Table::Configuration Configuration;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing 3D simplicity configurations." );
+  Table table( dt );
+  trace.info() << table << std::endl;
+  nbok += ( table.nbNeighbors() == 26 ) ? 1 : 0;
+  nb++;
+  nbok += checkConfiguration<TObject>( dt, table, 0 ) ? 1 : 0;
+  nb++;
+  nbok += checkConfiguration<TObject>( dt, table, table.nbConfigurations() - 1 ) ? 1 : 0;
+  nb++;
+  srand( 0 );
+  for ( unsigned int i = 0; i < 500; ++i )
+    {
+      Configuration cfg = ( ( (Configuration) rand() << 16 ) ^ (Configuration) rand() )
+        & ( table.nbConfigurations() - 1 );
+      nbok += checkConfiguration<TObject>( dt, table, cfg ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "sampled configurations agree with Object::isSimple." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SimplicityTable" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testTable2D<Z2i::Object4_8>( Z2i::dt4_8 )
+    && testTable2D<Z2i::Object8_4>( Z2i::dt8_4 )
+    && testTable3D<Z3i::Object6_26>( Z3i::dt6_26 )
+    && testTable3D<Z3i::Object26_6>( Z3i::dt26_6 )
+    && testTable3D<Z3i::Object6_18>( Z3i::dt6_18 )
+    && testTable3D<Z3i::Object18_6>( Z3i::dt18_6 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
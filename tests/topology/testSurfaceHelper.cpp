@@ -30,6 +30,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <fstream>
+#include <set>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtal/helpers/StdDefs.h"
@@ -223,6 +225,55 @@ bool testFindABel()
   return nbok == nb;
 }
 
+/**
+* Checks that method Surfaces::extractAllBoundaries extracts the same
+* boundaries as Surfaces::extractAllConnectedSCell.
+*/
+bool testExtractAllBoundaries()
+{
+  typedef Z3i::KSpace KSpace;
+  typedef KSpace::SCell SCell;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Surfaces::extractAllBoundaries." );
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 40 ) );
+  Z3i::DigitalSet aSet( domain );
+  for ( unsigned int i = 0; i < 20; ++i )
+    Shapes<Z3i::Domain>::addNorm2Ball( aSet, Z3i::Point( 5 + rand() % 30, 5 + rand() % 30,
+                                                         5 + rand() % 30 ), 1 + rand() % 4 );
+  KSpace K; K.init( domain.lowerBound(), domain.upperBound(), true );
+  Surfaces<KSpace>::CellKey cellKey( K );
+  for ( unsigned int i = 0; i < 2; ++i )
+    {
+      SurfelAdjacency<3> SAdj( i == 0 );
+      std::vector< std::vector<SCell> > vectConnectedSCell;
+      Surfaces<KSpace>::extractAllConnectedSCell( vectConnectedSCell, K, SAdj, aSet );
+      std::vector<Surfaces<KSpace>::Key> surfels;
+      std::vector<Surfaces<KSpace>::Size> offsets;
+      Surfaces<KSpace>::extractAllBoundaries( surfels, offsets, K, SAdj, aSet );
+      std::set< std::set<SCell> > boundaries, expected;
+      for ( unsigned int c = 0; c + 1 < offsets.size(); ++c )
+        {
+          std::set<SCell> boundary;
+          for ( Surfaces<KSpace>::Size j = offsets[ c ]; j < offsets[ c + 1 ]; ++j )
+            boundary.insert( cellKey.sCell( surfels[ j ] ) );
+          boundaries.insert( boundary );
+        }
+      for ( unsigned int c = 0; c < vectConnectedSCell.size(); ++c )
+        expected.insert( std::set<SCell>( vectConnectedSCell[ c ].begin(),
+                                          vectConnectedSCell[ c ].end() ) );
+      trace.info() << "- " << ( offsets.size() - 1 ) << " boundaries and "
+                   << surfels.size() << " bels, expected "
+                   << vectConnectedSCell.size() << " boundaries." << std::endl;
+      ++nb, nbok += ( offsets.size() == vectConnectedSCell.size() + 1 )
+        && ( boundaries == expected ) ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << " extractAllBoundaries == extractAllConnectedSCell" << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -235,7 +286,8 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testComputeInterior()
-    && testFindABel< KhalimskySpaceND<3,int> >();
+    && testFindABel< KhalimskySpaceND<3,int> >()
+    && testExtractAllBoundaries();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;